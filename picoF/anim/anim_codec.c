@@ -0,0 +1,36 @@
+#include "anim_codec.h"
+#include <string.h>
+
+void anim_decode_frame(const anim_stream_t* a, uint16_t i, uint8_t* fb) {
+    const uint8_t* src = &a->data[a->offsets[i]];
+    uint8_t* dst = fb;
+    uint8_t* end = fb + a->frame_bytes;
+
+    if (*src++ == ANIM_KEY) {
+        while (dst < end) {
+            uint8_t t = *src++;
+            if (t < 0x80) {
+                memcpy(dst, src, t + 1u);
+                src += t + 1u;
+                dst += t + 1u;
+            } else {
+                uint8_t n = (t & 0x3F) + 1;
+                memset(dst, t < 0xC0 ? 0 : *src++, n);
+                dst += n;
+            }
+        }
+        return;
+    }
+
+    while (dst < end) {
+        uint8_t t = *src++;
+        if (t < 0x80) {
+            for (int n = t + 1; n; n--) *dst++ ^= *src++;
+        } else if (t < 0xC0) {
+            dst += (t & 0x3F) + 1;
+        } else {
+            uint8_t v = *src++;
+            for (int n = (t & 0x3F) + 1; n; n--) *dst++ ^= v;
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef ANIM_CODEC_H
+#define ANIM_CODEC_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Compressed 1bpp clip. Frames are page-major framebuffers, stored in
+// playback order. Each frame's chunk starts with its type:
+//   ANIM_KEY   - the tokens write the whole frame
+//   ANIM_DELTA - the tokens XOR into the previous frame
+// followed by run tokens covering frame_bytes:
+//   0x00-0x7F  literal: (t + 1) bytes follow
+//   0x80-0xBF  zero run of (t & 0x3F) + 1 bytes (skipped in a delta)
+//   0xC0-0xFF  repeat run of (t & 0x3F) + 1 copies of the next byte
+//
+// Identical chunks are stored once, so offsets[] need not be increasing;
+// offsets[frame_count] is the size of data.
+typedef struct {
+    uint16_t width, height;
+    uint16_t frame_count;
+    uint16_t frame_bytes;       // width * height / 8
+    const uint32_t* offsets;    // frame_count + 1 chunk offsets into data
+    const uint16_t* durations;  // per-frame display time in ms, or NULL
+    const uint8_t* data;
+} anim_stream_t;
+
+enum { ANIM_KEY = 0, ANIM_DELTA = 1 };
+
+// Decode frame i into fb. A delta frame needs fb to hold frame i - 1;
+// frame 0 is always a key frame, so looping back to it is safe.
+void anim_decode_frame(const anim_stream_t* a, uint16_t i, uint8_t* fb);
+
+static inline bool anim_is_key(const anim_stream_t* a, uint16_t i) {
+    return a->data[a->offsets[i]] == ANIM_KEY;
+}
+
+// How long frame i stays up; fallback_ms for clips without a timing table
+static inline uint32_t anim_frame_ms(const anim_stream_t* a, uint16_t i, uint32_t fallback_ms) {
+    return a->durations ? a->durations[i] : fallback_ms;
+}
+
+// ---- Host side --------------------------------------------------------------
+// Encode cur as a key frame (prev == NULL) or whichever of key/delta is
+// smaller. out needs room for anim_encode_bound(n). Returns chunk size.
+size_t anim_encode_frame(const uint8_t* prev, const uint8_t* cur, size_t n, uint8_t* out);
+
+#define anim_encode_bound(n) (1 + (n) + ((n) + 127) / 128)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
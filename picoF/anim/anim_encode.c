@@ -0,0 +1,63 @@
+// Host-side encoder for anim_codec.h streams (not linked into the firmware)
+#include "anim_codec.h"
+#include <stdlib.h>
+#include <string.h>
+
+static size_t run_of(const uint8_t* p, size_t n, uint8_t v) {
+    size_t r = 0;
+    while (r < n && p[r] == v) r++;
+    return r;
+}
+
+// Zero runs of 2+ and repeats of 3+ beat literals; everything else is
+// gathered into literal runs of up to 128 bytes.
+static size_t tokenize(const uint8_t* src, size_t n, uint8_t* out) {
+    size_t i = 0, o = 0;
+    while (i < n) {
+        size_t z = run_of(&src[i], n - i, 0);
+        if (z >= 2 || (z == 1 && i + 1 == n)) {
+            if (z > 64) z = 64;
+            out[o++] = (uint8_t)(0x80 | (z - 1));
+            i += z;
+            continue;
+        }
+        size_t r = run_of(&src[i], n - i, src[i]);
+        if (r >= 3) {
+            if (r > 64) r = 64;
+            out[o++] = (uint8_t)(0xC0 | (r - 1));
+            out[o++] = src[i];
+            i += r;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < n && i - start < 128) {
+            if (i + 1 < n && src[i] == 0 && src[i + 1] == 0) break;
+            if (i + 2 < n && src[i] == src[i + 1] && src[i] == src[i + 2]) break;
+            i++;
+        }
+        out[o++] = (uint8_t)(i - start - 1);
+        memcpy(&out[o], &src[start], i - start);
+        o += i - start;
+    }
+    return o;
+}
+
+size_t anim_encode_frame(const uint8_t* prev, const uint8_t* cur, size_t n, uint8_t* out) {
+    out[0] = ANIM_KEY;
+    size_t key = 1 + tokenize(cur, n, &out[1]);
+    if (!prev) return key;
+
+    uint8_t* diff = malloc(n);
+    uint8_t* tmp = malloc(anim_encode_bound(n));
+    for (size_t i = 0; i < n; i++) diff[i] = prev[i] ^ cur[i];
+    tmp[0] = ANIM_DELTA;
+    size_t delta = 1 + tokenize(diff, n, &tmp[1]);
+    if (delta < key) {
+        memcpy(out, tmp, delta);
+        key = delta;
+    }
+    free(diff);
+    free(tmp);
+    return key;
+}
@@ -0,0 +1,102 @@
+#include "anim_player.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware_init.h"
+#include "assets.h"
+#include "input/input.h"
+#include "perf.h"
+
+#define ANIM_DEFAULT_MS 100
+
+// Frames dropped in a row before one is shown anyway and the schedule
+// restarts from now (a clip that can't keep up still moves)
+#define ANIM_MAX_DROPS 4
+
+static anim_stats_t s_stats;
+
+const anim_stats_t* anim_last_stats(void) { return &s_stats; }
+
+static void present(ssd1306_t* d) {
+    ssd1306_mark_dirty(d, 0, 0, d->width, d->height);
+    PERF_SCOPE(PERF_PRESENT) ssd1306_present_async(d);
+    perf_frame();
+}
+
+static bool poll_exit(void) {
+    input_update(to_ms_since_boot(get_absolute_time()));
+    return exit_combo_triggered();
+}
+
+void anim_play(const anim_clip_t* clip) {
+    anim_stream_t packed;
+    const anim_stream_t* a = clip->stream;
+    if (!a) {
+        if (clip->prefetch && asset_find(clip->asset) && !asset_prefetch(clip->asset))
+            printf("%s: \"%s\" doesn't fit the SRAM pool, playing from flash\n", clip->name, clip->asset);
+        if (!asset_clip(clip->asset, &packed)) {
+            printf("%s: no clip \"%s\" in the asset pack\n", clip->name, clip->asset);
+            return;
+        }
+        a = &packed;
+    }
+    ssd1306_t* d = &disp;
+    if (a->width != d->width || a->height != d->height || !a->frame_count) {
+        printf("%s: %ux%u clip on a %ux%u display\n", clip->name, a->width, a->height,
+               d->width, d->height);
+        return;
+    }
+    uint32_t fallback_ms = clip->default_ms ? clip->default_ms : ANIM_DEFAULT_MS;
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    // Whole-frame content: one window + one transaction beats per-page diffs.
+    // Frames decode in place (deltas XOR onto the previous frame), which is
+    // safe because a present has copied d->buf out by the time it returns.
+    uint8_t mode = d->present_mode;
+    ssd1306_set_present_mode(d, SSD1306_PRESENT_FULL);
+
+    uint16_t i = 0;
+    int drops = 0;
+    absolute_time_t due = get_absolute_time();      // When frame i goes up
+    while (!poll_exit()) {
+        absolute_time_t end = delayed_by_ms(due, anim_frame_ms(a, i, fallback_ms));
+        PERF_SCOPE(PERF_RENDER) {
+            uint32_t t0 = time_us_32();
+            anim_decode_frame(a, i, d->buf);
+            s_stats.decode_us += time_us_32() - t0;
+        }
+
+        bool last = i + 1 == a->frame_count;
+        bool hold = last && clip->loop == ANIM_ONCE;
+        absolute_time_t now = get_absolute_time();
+        if (absolute_time_diff_us(now, end) > 0 || hold || drops == ANIM_MAX_DROPS) {
+            if (absolute_time_diff_us(now, end) <= 0)
+                end = delayed_by_ms(now, anim_frame_ms(a, i, fallback_ms));
+            sleep_until(due);       // Returns at once when running late
+            present(d);
+            s_stats.shown++;
+            drops = 0;
+        } else {
+            s_stats.dropped++;
+            drops++;
+        }
+
+        if (hold) {
+            while (!poll_exit()) input_wait(at_the_end_of_time);
+            break;
+        }
+        i = last ? 0 : i + 1;
+        due = end;
+    }
+
+    uint32_t decoded = s_stats.shown + s_stats.dropped;
+    if (decoded)
+        printf("%s: %lu frames, %lu dropped, avg decode %lu us\n", clip->name,
+               (unsigned long)s_stats.shown, (unsigned long)s_stats.dropped,
+               (unsigned long)(s_stats.decode_us / decoded));
+
+    memset(d->buf, 0, sizeof(d->buf));
+    present(d);
+    ssd1306_set_present_mode(d, (ssd1306_present_t)mode);
+}
@@ -0,0 +1,58 @@
+#ifndef ANIM_PLAYER_H
+#define ANIM_PLAYER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "anim_codec.h"
+#include "registry.h"
+
+// Clip player shared by every frame-based animation. Clips come from the
+// flash asset pack (assets/assets.h) by name, or from a compiled-in stream.
+// Frames decode straight from flash into the display's framebuffer (no
+// local copy) and are presented on a deadline schedule: frame i goes up at
+// the sum of the durations before it. When decoding or the bus falls
+// behind, frames whose slot has already passed are decoded (a delta needs
+// its predecessor) but not presented, so playback keeps clip time instead
+// of stretching.
+//
+// The clip must match the display size. The perf overlay is not drawn:
+// the framebuffer is the decode reference for the next delta.
+
+typedef enum {
+    ANIM_LOOP = 0,      // Restart at frame 0 after the last frame
+    ANIM_ONCE,          // Hold the last frame until the exit combo
+} anim_loop_t;
+
+typedef struct {
+    const char* name;               // For the stdio report
+    const char* asset;              // Clip in the asset pack, or
+    const anim_stream_t* stream;    // a compiled-in one (picoF_add_clip)
+    uint16_t default_ms;            // Frame time for clips without durations (0 = 100)
+    uint8_t loop;                   // anim_loop_t
+    bool prefetch;                  // Play a pack clip from an SRAM copy (asset_prefetch)
+} anim_clip_t;
+
+typedef struct {
+    uint32_t shown;
+    uint32_t dropped;
+    uint32_t decode_us;             // Total over shown + dropped
+} anim_stats_t;
+
+// Play clip until the exit combo, then clear the screen and print
+//   <name>: N frames, M dropped, avg decode X us
+void anim_play(const anim_clip_t* clip);
+
+// Counters of the last (or current) anim_play
+const anim_stats_t* anim_last_stats(void);
+
+// Register an asset pack clip as a launcher program; the remaining
+// arguments are anim_clip_t fields.
+// Example:
+//   REGISTER_CLIP(animation_b, "Animation B", "animation_b", .default_ms = 100);
+//   // Defines: void run_animation_b(void), playing asset "animation_b"
+#define REGISTER_CLIP(ID, DISPLAY, ASSET, ...) \
+    static const anim_clip_t _clip_##ID = { .name = DISPLAY, .asset = ASSET, __VA_ARGS__ }; \
+    void run_##ID(void) { anim_play(&_clip_##ID); } \
+    REGISTER_PROGRAM(ID, DISPLAY, NULL)
+
+#endif // ANIM_PLAYER_H
@@ -1,14 +1,19 @@
 // animation_a.c
 // Animation A: bitwise plasma for 1bpp SSD1306 (128x64 default)
 // - No assets in flash
-// - ~1 KiB framebuffer in RAM
-// - Pure integer math (no floats, no LUTs)
+// - ~1 KiB framebuffer in RAM, plus ~0.7 KiB of tables rebuilt each frame
+// - Pure integer math (no floats), whole page bytes per column
 // - Zero heap allocation
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 #include "input/input.h" // added for exit_combo_triggered()
+#include "registry/registry.h"
+#include "animationA/animation_a.h"
+#include "present.h"     // present_report() on exit
+#include "perf.h"
+#include "hardware_config.h" // DISPLAY_CORE1
 
 #ifndef AA_DISPLAY_WIDTH
 #define AA_DISPLAY_WIDTH 128
@@ -17,6 +22,18 @@
 #define AA_DISPLAY_HEIGHT 64
 #endif
 
+// Split rendering across both cores (needs DISPLAY_CORE1 0)
+#ifndef AA_DUAL_CORE
+#define AA_DUAL_CORE 0
+#endif
+#if AA_DUAL_CORE && DISPLAY_CORE1
+#error "AA_DUAL_CORE needs core 1, which the present service owns with DISPLAY_CORE1"
+#endif
+#if AA_DUAL_CORE
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#endif
+
 #ifndef REGISTER_PROGRAM
 #define REGISTER_PROGRAM(fn, name, icon)
 #endif
@@ -28,52 +45,121 @@ extern void oled_present_mono_1bpp(const uint8_t* fb, int width, int height);
 static uint8_t s_fb[AA_DISPLAY_WIDTH * (AA_DISPLAY_HEIGHT / 8)]; // 128*64/8 = 1024 bytes
 
 static inline void fb_clear(void) { memset(s_fb, 0, sizeof(s_fb)); }
-static inline void fb_set(int x, int y) {
-    if ((unsigned)x >= AA_DISPLAY_WIDTH || (unsigned)y >= AA_DISPLAY_HEIGHT) return;
-    int index = x + (y >> 3) * AA_DISPLAY_WIDTH;
-    uint8_t bit = (uint8_t)(1u << (y & 7));
-    s_fb[index] |= bit;
-}
 
 // ---- Core animation ---------------------------------------------------------
+// Per pixel, all mod 256:
+//   a = (4x + t) ^ (4y + 3t)
+//   r = |x - cx| + |y - cy| + 2t
+//   on = ((a + 5r) ^ 4t) < 48 + (t & 31)
+// 5r splits into a column part 5|x - cx| and a row part 5(|y - cy| + 2t),
+// and the comparison depends only on the 8-bit sum, so per frame it becomes
+// a 256-entry table. What is left per pixel is an XOR, two adds and a
+// lookup; each column of a page is built as a whole byte and stored once.
+
+#define AA_PAGES (AA_DISPLAY_HEIGHT / 8)
+
+typedef struct {
+    uint8_t x_term[AA_DISPLAY_WIDTH];   // 4x + t
+    uint8_t x_r5[AA_DISPLAY_WIDTH];     // 5|x - cx|
+    uint8_t y_term[AA_DISPLAY_HEIGHT];  // 4y + 3t
+    uint8_t y_r5[AA_DISPLAY_HEIGHT];    // 5(|y - cy| + 2t)
+    uint8_t on[256];                    // Threshold test by a + 5r
+} plasma_t;
+
+static plasma_t s_pl;
+
 static inline int iabs_int(int v) { return (v ^ (v >> 31)) - (v >> 31); }
 
-static void render_frame(uint8_t t) {
-    fb_clear();
+static void plasma_prepare(uint8_t t) {
     const int cx = AA_DISPLAY_WIDTH / 2;
     const int cy = AA_DISPLAY_HEIGHT / 2;
+    for (int x = 0; x < AA_DISPLAY_WIDTH; ++x) {
+        s_pl.x_term[x] = (uint8_t)((x << 2) + (int)t);
+        s_pl.x_r5[x] = (uint8_t)(iabs_int(x - cx) * 5);
+    }
     for (int y = 0; y < AA_DISPLAY_HEIGHT; ++y) {
-        const int yTerm = (y << 2) + (int)t * 3;
-        const int dy = iabs_int(y - cy);
+        s_pl.y_term[y] = (uint8_t)((y << 2) + (int)t * 3);
+        s_pl.y_r5[y] = (uint8_t)((iabs_int(y - cy) + ((int)t << 1)) * 5);
+    }
+    const uint8_t threshold = (uint8_t)(48 + (t & 0x1F));
+    const uint8_t flip = (uint8_t)(t << 2);
+    for (int u = 0; u < 256; ++u) s_pl.on[u] = (uint8_t)((uint8_t)(u ^ flip) < threshold);
+}
+
+static void render_pages(int p0, int p1) {
+    for (int page = p0; page < p1; ++page) {
+        const uint8_t* yt = &s_pl.y_term[page * 8];
+        const uint8_t* yr = &s_pl.y_r5[page * 8];
+        uint8_t* out = &s_fb[page * AA_DISPLAY_WIDTH];
         for (int x = 0; x < AA_DISPLAY_WIDTH; ++x) {
-            const int xTerm = (x << 2) + (int)t;
-            const int dx = iabs_int(x - cx);
-            const uint8_t a = (uint8_t)(xTerm ^ yTerm);
-            const uint8_t r = (uint8_t)(dx + dy + ((int)t << 1));
-            const uint8_t u = (uint8_t)(a + (r * 5));
-            const uint8_t threshold = (uint8_t)(48 + ((t & 0x1F)));
-            const bool on = ((uint8_t)(u ^ (t << 2)) < threshold);
-            if (on) fb_set(x, y);
+            const uint8_t xt = s_pl.x_term[x];
+            const uint8_t xr = s_pl.x_r5[x];
+            uint8_t bits = 0;
+            for (int b = 0; b < 8; ++b)
+                bits |= (uint8_t)(s_pl.on[(uint8_t)((xt ^ yt[b]) + xr + yr[b])] << b);
+            out[x] = bits;
         }
     }
 }
 
+// Optionally core 1 renders the bottom half of each frame. The present
+// service must stay on core 0 for that (DISPLAY_CORE1 0).
+#if AA_DUAL_CORE
+static void core1_render(void) {
+    while (true) {
+        (void)multicore_fifo_pop_blocking();
+        __dmb();
+        render_pages(AA_PAGES / 2, AA_PAGES);
+        __dmb();
+        multicore_fifo_push_blocking(0);
+    }
+}
+#endif
+
+static void render_frame(uint8_t t) {
+    plasma_prepare(t);
+#if AA_DUAL_CORE
+    __dmb();
+    multicore_fifo_push_blocking(t);
+    render_pages(0, AA_PAGES / 2);
+    (void)multicore_fifo_pop_blocking();
+    __dmb();
+#else
+    render_pages(0, AA_PAGES);
+#endif
+}
+
+// Single core whatever AA_DUAL_CORE says: core 1 only runs inside
+// run_animation_a
+void animation_a_render(uint8_t t) {
+    plasma_prepare(t);
+    render_pages(0, AA_PAGES);
+}
+
 // Public entry point for the launcher.
 void run_animation_a(void) {
     uint8_t t = 0;
     fb_clear();
     oled_present_mono_1bpp(s_fb, AA_DISPLAY_WIDTH, AA_DISPLAY_HEIGHT);
+    present_reset_stats();
+#if AA_DUAL_CORE
+    multicore_launch_core1(core1_render);
+#endif
 
     while (true) {
         uint32_t now = to_ms_since_boot(get_absolute_time());
         input_update(now);
         if (exit_combo_triggered()) {
+            present_report("animation_a");
+#if AA_DUAL_CORE
+            multicore_reset_core1();
+#endif
             fb_clear();
             oled_present_mono_1bpp(s_fb, AA_DISPLAY_WIDTH, AA_DISPLAY_HEIGHT);
             return;
         }
 
-        render_frame(t);
+        PERF_SCOPE(PERF_RENDER) render_frame(t);
         oled_present_mono_1bpp(s_fb, AA_DISPLAY_WIDTH, AA_DISPLAY_HEIGHT);
         t += 1;
     }
@@ -0,0 +1,11 @@
+#ifndef ANIMATION_A_H
+#define ANIMATION_A_H
+
+#include <stdint.h>
+
+void run_animation_a(void);
+
+// Render frame t into the local framebuffer (benchmark hook)
+void animation_a_render(uint8_t t);
+
+#endif
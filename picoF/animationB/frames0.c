@@ -1,106 +0,0 @@
-#include "frames0.h"
-
-const unsigned char frames0[FRAME_COUNT][1024] = {
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFC, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF, 0xDF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xDF, 0xFF, 0xD7, 0x7F, 0xFE, 0x90, 0x0A, 0xFF, 0xF8, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x7F, 0xFF, 0x5D, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0xE0, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xDF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xD6, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFD, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0xE9, 0x00, 0xAF, 0xFF, 0x82, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x7F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFF, 0x5D, 0x00, 0x0E, 0x3F, 0xFF, 0xFF, 0xF5, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xA4, 0x02, 0xBF, 0xFE, 0x08, 0x5F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xFD, 0x77, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0xDF, 0xFF, 0xD7, 0x7F, 0xFF, 0x90, 0x0A, 0xFF, 0xF8, 0x21, 0x7F, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xF5, 0xDE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0x5F, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0x40, 0x2B, 0xFF, 0xE0, 0x84, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFE, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xD7, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0x00, 0xAF, 0xFF, 0x82, 0x17, 0xC3, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x5D, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF5, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0x02, 0xBF, 0xFE, 0x08, 0x5F, 0xC3, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xD7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0x77, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xD7, 0xDF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0x0A, 0xFF, 0xF8, 0x21, 0x7E, 0x00, 0x06, 0x3F, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xDF, 0xFF, 0x00, 0x0E, 0x3F, 0xFF, 0x5F, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0x2B, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC3, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0x1F, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xF5, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x5D, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xF5, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFE, 0x08, 0x5F, 0xFE, 0x00, 0x06, 0x3F, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xC3, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD7, 0xDF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xF8, 0x21, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xC3, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x5F, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xEA, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3D, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3D, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0xD7, 0x7F, 0xFF, 0xFE, 0x00, 0x06, 0x3D, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x00, 0x06, 0x3D, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC1, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFB, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x35, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x35, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0x1F, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xC3, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x17, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xD7, 0xDF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0x9A, 0xF8, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x1F, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0xE0, 0x85, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x1F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xC3, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xC3, 0xFD, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF7, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0x77, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x1F, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0x21, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x15, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x43, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x3F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xC3, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x01, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0D, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC3, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFB, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFB, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x04, 0x3F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xC3, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xC3, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC3, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0x3D, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0x38, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xC3, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x81, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x06, 0x37, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x0E, 0x35, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0x1F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xC3, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x81, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x06, 0x1F, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x0F, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0x1F, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xC3, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x06, 0x1D, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x06, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xC3, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x81, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x43, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xC3, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0x81, 0xF7, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFB, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xF7, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x57, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0x43, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC3, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xD7, 0xDE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xD7, 0xD4, 0x00, 0x02, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xC3, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x81, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5F, 0x7F, 0x00, 0x0C, 0x3F, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xC3, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF9, 0x81, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x40, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x7D, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x01, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xC3, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xF7, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7E, 0x00, 0x04, 0x3F, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xC3, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x80, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xD7, 0xDF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xC2, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xF9, 0x81, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5F, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x00, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xC3, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0x00, 0x06, 0x3F, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x7D, 0xFF, 0xFC, 0x00, 0x06, 0x3F, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x00, 0x06, 0x3F, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xC3, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x81, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF7, 0x00, 0x06, 0x3F, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xF7, 0xFF, 0xF5, 0x00, 0x0E, 0x3F, 0xFE, 0xA6, 0xB6, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0x1F, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xC3, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9, 0x81, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFE, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xDF, 0x00, 0x06, 0x3F, 0xF2, 0xD2, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xD7, 0xDF, 0xFF, 0xD7, 0x00, 0x0F, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x17, 0x1F, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC3, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0x00, 0x06, 0x3F, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x5F, 0x7F, 0xFF, 0x5C, 0x00, 0x06, 0x3F, 0xEA, 0x6B, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFF, 0x5F, 0x57, 0xFE, 0x08, 0x00, 0x06, 0x3A, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xC3, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x81, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x7D, 0xFF, 0xFD, 0x77, 0x00, 0x00, 0x7F, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x7D, 0x5F, 0xF8, 0x21, 0x43, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0x83, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF9, 0x01, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0xF7, 0xFF, 0xF5, 0xDF, 0x00, 0x00, 0xFE, 0xA6, 0xB6, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xF5, 0xF5, 0x7F, 0xE0, 0x85, 0xC3, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xC3, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3E, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0x06, 0x32, 0xD2, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xD7, 0xDF, 0xFF, 0xD7, 0x7E, 0x00, 0x06, 0x3A, 0x9A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xD7, 0xD5, 0xFF, 0x82, 0x16, 0x00, 0x06, 0x10, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xC2, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0x80, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x12, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x39, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0x00, 0x06, 0x0B, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0x5F, 0x7F, 0xFF, 0x5D, 0xFF, 0x00, 0x0E, 0x2A, 0x6B, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0x5F, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0x1A, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xC1, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF9, 0x81, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x27, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x06, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0x7D, 0xFF, 0xFD, 0x77, 0xFF, 0x00, 0x0F, 0xA9, 0xAD, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0x7D, 0x5F, 0xF8, 0x21, 0x7F, 0xFF, 0x09, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xC3, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x1F, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x04, 0x34, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xF7, 0xFF, 0xF5, 0xDF, 0xFE, 0x00, 0x06, 0x26, 0xB6, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xEA, 0xF5, 0x7F, 0xE0, 0x85, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xC3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0x81, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x12, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x00, 0x52, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0xDF, 0xFF, 0xD7, 0x7F, 0xFF, 0x00, 0x00, 0x1A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xAB, 0xD5, 0xFF, 0x82, 0x17, 0xFF, 0xC2, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xC3, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xD9, 0x81, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x60, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0x00, 0x00, 0x6B, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0xAF, 0x57, 0xFE, 0x08, 0x5F, 0xFF, 0xC2, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xC3, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x81, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x27, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x77, 0xFF, 0xFE, 0x00, 0x00, 0x2D, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0x5F, 0xF8, 0x21, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x83, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0x81, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x12, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x1F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x37, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0x00, 0x06, 0x36, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xEA, 0xFF, 0x7F, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x43, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xF9, 0x01, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x12, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x1F, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0x00, 0x0A, 0xDB, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0x81, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x12, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x3F, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0x2F, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0x08, 0x5F, 0xFF, 0xFA, 0x00, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xC3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0x81, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0x12, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF8, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xC3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xF9, 0x81, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x12, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xC3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xE9, 0x81, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x12, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x06, 0x3D, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFA, 0x00, 0x02, 0x3D, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x82, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x08, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xD9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x06, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0x00, 0x06, 0x35, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x5D, 0xFF, 0xFF, 0xFF, 0xEA, 0x00, 0x0E, 0x35, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0x08, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xD9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xB0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xD0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x06, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x06, 0x17, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF7, 0x77, 0xFF, 0xFF, 0xFF, 0xA9, 0x00, 0x0F, 0xD5, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF5, 0x21, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0x79, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x80, 0x06, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0x00, 0x06, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0xFF, 0xFE, 0xA6, 0x00, 0x06, 0x17, 0xFD, 0xBF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xD7, 0x85, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x02, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7E, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0x70, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xFF, 0xFA, 0x9A, 0x00, 0x00, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x5D, 0x17, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xBF, 0xFF, 0xFD, 0xFE, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFD, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFE, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x00, 0x00, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x00, 0x00, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0x77, 0x5F, 0xFF, 0xFA, 0x40, 0x00, 0x01, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xFD, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0x80, 0x02, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0x00, 0x06, 0x3F, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xAC, 0x00, 0x04, 0x3F, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF5, 0xDF, 0x7F, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0xE0, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xF7, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFB, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0x00, 0x06, 0x3D, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0x00, 0x06, 0x3D, 0xBF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF9, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xEF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xF7, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0x00, 0x06, 0x37, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xDF, 0xF8, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xEF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0x00, 0x06, 0x1F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6E, 0x00, 0x06, 0x1B, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xDF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0xE0, 0x85, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x7F, 0xBF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xBF, 0x7F, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0x7E, 0xFF, 0xF1, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0xFC, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFE, 0x90, 0x00, 0x01, 0x48, 0x00, 0x00, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xE9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xFE, 0xFE, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0x00, 0x06, 0x3F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0x00, 0x0A, 0x3F, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFB, 0xFD, 0xFF, 0xD9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0xFD, 0xFB, 0xFF, 0xD0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0xFD, 0xFD, 0xFF, 0xE0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0x00, 0x06, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0x00, 0x06, 0x3F, 0xFF, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0x00, 0x0F, 0xFF, 0xFF, 0xFA, 0xBF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFF, 0xFB, 0xF7, 0xFF, 0xB9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF, 0xFB, 0xFB, 0xFF, 0xD0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0x80, 0x06, 0x3F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB4, 0xB7, 0xFF, 0x5F, 0x00, 0x06, 0x3F, 0xFF, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA6, 0xB6, 0xFF, 0x56, 0x00, 0x06, 0x3F, 0xFF, 0xEA, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x52, 0x00, 0x00, 0x06, 0x3F, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xF7, 0xEF, 0xFF, 0x79, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFF, 0xF7, 0xF7, 0xFF, 0xB0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x7F, 0xFF, 0x3F, 0x00, 0x04, 0x7F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD2, 0xDF, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xAF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x9A, 0xDB, 0xFD, 0x5F, 0x00, 0x00, 0x7F, 0xFF, 0xAB, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFF, 0xDF, 0xEF, 0xFE, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFF, 0xEF, 0xDF, 0xFE, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFF, 0xEF, 0xEF, 0xFF, 0x70, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFC, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x4B, 0x7F, 0xF5, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x6B, 0x6F, 0xF5, 0x7F, 0x00, 0x00, 0xFF, 0xFE, 0xAF, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xFF, 0xDF, 0xBF, 0xFD, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xE7, 0xFF, 0xF3, 0xFF, 0x80, 0x06, 0x3F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x2D, 0xFF, 0xD7, 0xFF, 0x00, 0x06, 0x3F, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xA9, 0xAD, 0xBF, 0xD5, 0xFE, 0x00, 0x06, 0x3F, 0xFA, 0xBF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x80, 0x54, 0x00, 0x06, 0x3E, 0x90, 0x0A, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xCF, 0xFF, 0x00, 0x06, 0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0xB7, 0xFF, 0x5F, 0xFD, 0x00, 0x06, 0x3F, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0xB6, 0xFF, 0x57, 0xFD, 0x00, 0x0E, 0x3F, 0xEA, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x52, 0x01, 0x50, 0x0F, 0x1F, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xFF, 0x3F, 0xFF, 0x00, 0x06, 0x3F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xDF, 0xFD, 0x7F, 0xF7, 0x00, 0x06, 0x3F, 0xAF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xDB, 0xFD, 0x5F, 0xF6, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x48, 0x05, 0x40, 0x3F, 0x1F, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x7F, 0xF5, 0xFF, 0xDF, 0x00, 0x06, 0x3E, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x6F, 0xF5, 0x7F, 0xDA, 0x00, 0x06, 0x3E, 0xAF, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0x20, 0x15, 0x00, 0x00, 0x06, 0x24, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0xFF, 0x00, 0x04, 0x7E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xFF, 0xD7, 0xFF, 0x7F, 0x00, 0x00, 0x7A, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xBF, 0xD5, 0xFF, 0x6F, 0x00, 0x00, 0x7A, 0xBF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x14, 0x80, 0x54, 0x03, 0xC3, 0xFE, 0x90, 0x0A, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xF7, 0xFB, 0xFF, 0xBF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFB, 0xF7, 0xFF, 0xBF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFB, 0xFB, 0xFF, 0xDF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB7, 0xFF, 0x5F, 0xFD, 0xFF, 0x00, 0x00, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xFF, 0x57, 0xFD, 0xBF, 0x00, 0x00, 0xEA, 0xFF, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x52, 0x01, 0x50, 0x0F, 0xC3, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xF7, 0xEF, 0xFF, 0x7F, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xF7, 0xF7, 0xFF, 0xBF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0xFF, 0x80, 0x06, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0x7F, 0xF7, 0xFF, 0x00, 0x06, 0x2F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFD, 0x5F, 0xF6, 0xFE, 0x00, 0x06, 0x2B, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x48, 0x05, 0x40, 0x3E, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x70, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xEF, 0xDF, 0xFE, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xEF, 0xEF, 0xFF, 0x7F, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF5, 0xFF, 0xDF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xF5, 0x7F, 0xDB, 0xFF, 0x00, 0x0E, 0x2F, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0x04, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xBF, 0xDF, 0xFD, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xDF, 0xBF, 0xFD, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xDF, 0xDF, 0xFE, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x7F, 0xFF, 0x00, 0x02, 0x3F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xD5, 0xFF, 0x6F, 0xFF, 0x00, 0x0A, 0xBF, 0xFF, 0xF5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x10, 0x0A, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x80, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xBF, 0x7F, 0xFB, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xBF, 0xBF, 0xFD, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFD, 0xFF, 0xFF, 0x00, 0x02, 0x3F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFD, 0xBF, 0xFE, 0x00, 0x02, 0x3F, 0xFF, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x01, 0x50, 0x0F, 0xFE, 0x00, 0x00, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0x7E, 0xFF, 0xF7, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0x7F, 0x7F, 0xFB, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x7F, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x5F, 0xF6, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x48, 0x05, 0x40, 0x3F, 0xFF, 0xC1, 0x00, 0xAF, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFE, 0xFF, 0xEF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xFD, 0xFF, 0xEF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xBF, 0xFE, 0xFF, 0xF7, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF5, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF5, 0x7F, 0xDB, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x15, 0x00, 0xFF, 0xFF, 0x80, 0x02, 0xBF, 0xF8, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFB, 0xFF, 0xDF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFD, 0xFF, 0xEF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xD7, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xD5, 0xFF, 0x6F, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xF5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x54, 0x03, 0xFF, 0xFE, 0x00, 0x02, 0x3F, 0xE0, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0x00, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0x00, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0x00, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0x00, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0x00, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0x40, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0x40, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xE0, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0x70, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xE0, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xE1, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xF0, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xF8, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xF1, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xF7, 0xFF, 0xBF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFB, 0xFF, 0xDF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0x5F, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x57, 0xFD, 0xBF, 0xFF, 0xFF, 0x00, 0x0E, 0x3F, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x0B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0x00, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0x00, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0x00, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0x00, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0x00, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0x00, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0x80, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0x80, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xC1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xE0, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xC3, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xE1, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF1, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xE3, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xE3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xF3, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xEF, 0xFF, 0x7F, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xF7, 0xFF, 0xBF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0x5F, 0xF6, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0x05, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0x0F, 0xFE, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x00, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x00, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0x00, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0x00, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0x00, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0x00, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0x00, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0x01, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0x83, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xC1, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0x87, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xE3, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xC7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xC7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xE7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xEF, 0xFF, 0x7F, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x7F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x7F, 0xDB, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3D, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFB, 0x15, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x06, 0x38, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x00, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x00, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x00, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x00, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0x01, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0x01, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0x03, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0x07, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0x83, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0x0F, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xC7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0x8F, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0x8F, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xBF, 0xFD, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x75, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEF, 0x54, 0x03, 0xFF, 0xFE, 0x90, 0x02, 0xFF, 0xE0, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x00, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x00, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x00, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x01, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x01, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x03, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0x03, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x07, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x0F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x07, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0x1F, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0x8F, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0x1F, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0x1F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0x9F, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0xDF, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0x7F, 0xFB, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xBF, 0xFD, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0xD7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xBF, 0x50, 0x0F, 0xFF, 0xFA, 0x40, 0x03, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x00, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x00, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x02, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x02, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x06, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x07, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x0F, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1F, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x0F, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x1F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0x3F, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0x3F, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xBF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0x7F, 0xFB, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x06, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xFF, 0x40, 0x3F, 0xFF, 0xE9, 0x00, 0x00, 0x06, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x04, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x08, 0x0E, 0x04, 0x0F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x10, 0x38, 0x00, 0x00, 0x20, 0x38, 0x00, 0x08, 0x1E, 0x04, 0x1F, 0xC1, 0x81, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x20, 0x78, 0x00, 0x08, 0x1F, 0x0E, 0x0F, 0x81, 0xC1, 0x00, 0x80, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x20, 0x7C, 0x00, 0x1C, 0x3F, 0x06, 0x0F, 0xC3, 0xE3, 0x80, 0x80, 0x20, 0x38, 0x38, 0x00, 0x00, 0x70, 0xFC, 0x04, 0x0C, 0x1F, 0x07, 0x1F, 0xC7, 0xC1, 0x81, 0x80, 0x20, 0x7C, 0x18, 0x00, 0x10, 0x30, 0x7C, 0x04, 0x0E, 0x1F, 0x8E, 0x3F, 0xE3, 0xC1, 0xC1, 0xC0, 0x70, 0xFE, 0x3C, 0x00, 0x10, 0x38, 0x7E, 0x0C, 0x1C, 0x3F, 0xC6, 0x1F, 0xC7, 0xE3, 0x83, 0xE0, 0xF0, 0x7C, 0x3C, 0x00, 0x30, 0x70, 0xFF, 0x0E, 0x0C, 0x1F, 0x8F, 0x1F, 0xEF, 0xE1, 0x87, 0xC0, 0x78, 0x7E, 0x3C, 0x40, 0x38, 0x30, 0x7E, 0x1F, 0x1E, 0x1F, 0x8F, 0x3F, 0xF7, 0xF3, 0xC3, 0xC0, 0x70, 0xFE, 0x7E, 0x40, 0x7C, 0x78, 0x7E, 0x3E, 0x1E, 0x3F, 0x8F, 0x7F, 0xE7, 0xE3, 0xC7, 0xE0, 0xF1, 0xFE, 0xFE, 0xE0, 0xF8, 0x78, 0xFE, 0x1E, 0x1E, 0x3F, 0xDF, 0xBF, 0xEF, 0xF3, 0xCF, 0xE0, 0xF8, 0xFE, 0x7E, 0x70, 0x78, 0x78, 0xFF, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xE7, 0xF1, 0xF8, 0xFE, 0xFE, 0xE0, 0xFC, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xE0, 0xF9, 0xFF, 0x7D, 0xE1, 0xFD, 0xFE, 0xFF, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF0, 0xFE, 0xFD, 0xFE, 0x3F, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xF8, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xDF, 0xF7, 0xEF, 0xF8, 0xFD, 0xFF, 0x7D, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF0, 0xFB, 0xFF, 0x7E, 0xF1, 0xFE, 0xFD, 0xFE, 0xFF, 0xDF, 0xBF, 0xDF, 0xBF, 0xCF, 0xEF, 0xF7, 0xF1, 0xFD, 0xFE, 0xFE, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xBF, 0xBF, 0xF7, 0xEF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xDF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFE, 0xFD, 0xF9, 0xFE, 0xFD, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFB, 0xFB, 0xFF, 0x7E, 0xFD, 0x7F, 0xDF, 0xDF, 0xBF, 0xDF, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x7F, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xFF, 0xDF, 0xEF, 0xEF, 0xFB, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xBE, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x7F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xBF, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFE, 0xAF, 0x00, 0x0C, 0x37, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFB, 0xFF, 0x00, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0x18, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x08, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x78, 0x00, 0x10, 0x1C, 0x08, 0x1F, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x40, 0x70, 0x00, 0x10, 0x3C, 0x08, 0x3F, 0x83, 0x02, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x40, 0xF0, 0x00, 0x10, 0x3E, 0x1C, 0x1F, 0x03, 0x82, 0x01, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x38, 0x7E, 0x0C, 0x1F, 0x87, 0xC7, 0x01, 0x00, 0x40, 0x70, 0x70, 0x00, 0x00, 0xE1, 0xF8, 0x08, 0x18, 0x3E, 0x0E, 0x3F, 0x8F, 0x83, 0x03, 0x00, 0x40, 0xF8, 0x30, 0x00, 0x20, 0x60, 0xF8, 0x08, 0x1C, 0x3F, 0x1C, 0x7F, 0xC7, 0x83, 0x83, 0x80, 0xE1, 0xFC, 0x78, 0x00, 0x20, 0x70, 0xFC, 0x18, 0x38, 0x7F, 0x8C, 0x3F, 0x8F, 0xC7, 0x07, 0xC1, 0xE0, 0xF8, 0x78, 0x00, 0x60, 0xE1, 0xFE, 0x1C, 0x18, 0x3F, 0x1E, 0x3F, 0xDF, 0xC3, 0x0F, 0x80, 0xF0, 0xFC, 0x78, 0x80, 0x70, 0x60, 0xFC, 0x3E, 0x3C, 0x3F, 0x1E, 0x7F, 0xEF, 0xE7, 0x87, 0x80, 0xE1, 0xFC, 0xFC, 0x80, 0xF8, 0xF0, 0xFC, 0x7C, 0x3C, 0x7F, 0x1E, 0xFF, 0xCF, 0xC7, 0x8F, 0xC1, 0xE3, 0xFD, 0xFD, 0xC1, 0xF0, 0xF1, 0xFC, 0x3C, 0x3C, 0x7F, 0xBF, 0x7F, 0xDF, 0xE7, 0x9F, 0xC1, 0xF1, 0xFC, 0xFC, 0xE0, 0xF0, 0xF1, 0xFE, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xCF, 0xE3, 0xF1, 0xFD, 0xFD, 0xC1, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xC1, 0xF3, 0xFE, 0xFB, 0xC3, 0xFB, 0xFD, 0xFE, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE1, 0xFD, 0xFB, 0xFD, 0x7E, 0xFF, 0x7F, 0xBF, 0x7F, 0xDF, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF1, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0xBF, 0xEF, 0xDF, 0xF1, 0xFB, 0xFE, 0xFB, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xE1, 0xF7, 0xFE, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0x7F, 0x9F, 0xDF, 0xEF, 0xE3, 0xFB, 0xFD, 0xFD, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0x7F, 0x7F, 0xEF, 0xDF, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFD, 0xFB, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xDF, 0xF7, 0xFB, 0xFD, 0xFB, 0xF3, 0xFD, 0xFB, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xF7, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0xBF, 0xBF, 0x7F, 0xBF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xDF, 0x7F, 0xFF, 0xFF, 0xBF, 0xDF, 0xDF, 0xF7, 0xFF, 0xFF, 0xFB, 0xF3, 0xFF, 0x7D, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xF7, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFA, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFA, 0xBF, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEF, 0xFF, 0x03, 0xFF, 0xFE, 0x90, 0x0A, 0xFF, 0x00, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x10, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x20, 0x38, 0x10, 0x3E, 0x02, 0x04, 0x00, 0x00, 0x00, 0x40, 0xE0, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x20, 0x78, 0x10, 0x7F, 0x06, 0x04, 0x00, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x20, 0x7C, 0x38, 0x3E, 0x07, 0x04, 0x02, 0x00, 0x00, 0xE0, 0x70, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x70, 0xFC, 0x18, 0x3F, 0x0F, 0x8E, 0x02, 0x00, 0x80, 0xE0, 0xE0, 0x00, 0x01, 0xC3, 0xF0, 0x10, 0x30, 0x7C, 0x1C, 0x7F, 0x1F, 0x06, 0x06, 0x00, 0x81, 0xF0, 0x60, 0x00, 0x40, 0xC1, 0xF0, 0x10, 0x38, 0x7E, 0x38, 0xFF, 0x8F, 0x07, 0x07, 0x01, 0xC3, 0xF8, 0xF0, 0x00, 0x40, 0xE1, 0xF8, 0x30, 0x70, 0xFF, 0x18, 0x7F, 0x1F, 0x8E, 0x0F, 0x83, 0xC1, 0xF0, 0xF0, 0x00, 0xC1, 0xC3, 0xFC, 0x38, 0x30, 0x7E, 0x3C, 0x7F, 0xBF, 0x86, 0x1F, 0x01, 0xE1, 0xF8, 0xF1, 0x00, 0xE0, 0xC1, 0xF8, 0x7C, 0x78, 0x7E, 0x3C, 0xFF, 0xDF, 0xCF, 0x0F, 0x01, 0xC3, 0xF9, 0xF9, 0x01, 0xF1, 0xE1, 0xF8, 0xF8, 0x78, 0xFE, 0x3D, 0xFF, 0x9F, 0x8F, 0x1F, 0x83, 0xC7, 0xFB, 0xFB, 0x83, 0xE1, 0xE3, 0xF8, 0x78, 0x78, 0xFF, 0x7E, 0xFF, 0xBF, 0xCF, 0x3F, 0x83, 0xE3, 0xF9, 0xF9, 0xC1, 0xE1, 0xE3, 0xFD, 0xFC, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0x9F, 0xC7, 0xE3, 0xFB, 0xFB, 0x83, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0x83, 0xE7, 0xFD, 0xF7, 0x87, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC3, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xE3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xBF, 0xE3, 0xF7, 0xFD, 0xF7, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xC3, 0xEF, 0xFD, 0xFB, 0xC7, 0xFB, 0xF7, 0xFB, 0xFF, 0x7E, 0xFF, 0x7E, 0xFF, 0x3F, 0xBF, 0xDF, 0xC7, 0xF7, 0xFB, 0xFB, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7E, 0xFE, 0xFF, 0xDF, 0xBF, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFB, 0xF7, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xBF, 0xEF, 0xF7, 0xFB, 0xF7, 0xE7, 0xFB, 0xF7, 0xFB, 0xFF, 0x7E, 0xFD, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xF7, 0xFB, 0xFF, 0xEF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFF, 0x7F, 0x7E, 0xFF, 0x7E, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFD, 0xFD, 0xFB, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF, 0xEF, 0xFF, 0xFF, 0xF7, 0xE7, 0xFE, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xEA, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xBF, 0xFF, 0x0F, 0xFF, 0xFA, 0x40, 0x2A, 0x00, 0x02, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xAB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x70, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x20, 0x38, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x40, 0x70, 0x20, 0x7C, 0x04, 0x08, 0x00, 0x00, 0x00, 0x81, 0xC0, 0x00, 0x01, 0x01, 0xC0, 0x00, 0x40, 0xF0, 0x20, 0xFE, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x01, 0x03, 0xC0, 0x00, 0x40, 0xF8, 0x70, 0x7C, 0x0E, 0x08, 0x04, 0x00, 0x01, 0xC0, 0xE0, 0x00, 0x01, 0x03, 0xE1, 0x00, 0xE1, 0xF8, 0x30, 0x7E, 0x1F, 0x1C, 0x04, 0x01, 0x01, 0xC1, 0xC0, 0x00, 0x03, 0x87, 0xE0, 0x20, 0x60, 0xF8, 0x38, 0xFE, 0x3E, 0x0C, 0x0C, 0x01, 0x03, 0xE0, 0xC0, 0x00, 0x81, 0x83, 0xE0, 0x20, 0x70, 0xFC, 0x71, 0xFF, 0x1E, 0x0E, 0x0E, 0x03, 0x87, 0xF1, 0xE0, 0x00, 0x81, 0xC3, 0xF1, 0x60, 0xE1, 0xFE, 0x30, 0xFE, 0x3F, 0x1C, 0x1F, 0x07, 0x83, 0xE1, 0xE0, 0x01, 0x83, 0x87, 0xF8, 0x70, 0x60, 0xFC, 0x78, 0xFF, 0x7F, 0x0C, 0x3E, 0x03, 0xC3, 0xF1, 0xE2, 0x01, 0xC1, 0x83, 0xF1, 0xF8, 0xF0, 0xFC, 0x79, 0xFF, 0xBF, 0x9E, 0x1E, 0x03, 0x87, 0xF3, 0xF2, 0x03, 0xE3, 0xC3, 0xF1, 0xF0, 0xF1, 0xFC, 0x7B, 0xFF, 0x3F, 0x1E, 0x3F, 0x07, 0x8F, 0xF7, 0xF7, 0x07, 0xC3, 0xC7, 0xF1, 0xF0, 0xF1, 0xFE, 0xFD, 0xFF, 0x7F, 0x9E, 0x7F, 0x07, 0xC7, 0xF3, 0xF3, 0x83, 0xC3, 0xC7, 0xFB, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x3F, 0x8F, 0xC7, 0xF7, 0xF7, 0x07, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x07, 0xCF, 0xFB, 0xEF, 0x0F, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x87, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFF, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xC7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0x7F, 0xC7, 0xEF, 0xFB, 0xEF, 0x8F, 0xF7, 0xEF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7F, 0xBF, 0x7F, 0x87, 0xDF, 0xFB, 0xF7, 0x8F, 0xF7, 0xEF, 0xF7, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0x7F, 0x7F, 0xBF, 0x8F, 0xEF, 0xF7, 0xF7, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFD, 0xFD, 0xFF, 0xBF, 0x7F, 0xCF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0x7F, 0xDF, 0xEF, 0xF7, 0xEF, 0xCF, 0xF7, 0xEF, 0xF7, 0xFE, 0xFD, 0xFB, 0xFF, 0x7E, 0xFF, 0x7F, 0xBF, 0xEF, 0xF7, 0xFF, 0xDF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0xFF, 0xEF, 0xEF, 0xFB, 0xFB, 0xF7, 0xFF, 0x7D, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0x7F, 0xDF, 0xFF, 0xFF, 0xEF, 0xCF, 0xFD, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE9, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF5, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE1, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xFF, 0xFD, 0x3F, 0xFF, 0xE9, 0x00, 0xAF, 0xC2, 0x08, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x40, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x00, 0x80, 0xE0, 0x40, 0xF8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x03, 0x80, 0x00, 0x02, 0x03, 0x81, 0x00, 0x81, 0xE0, 0x41, 0xFC, 0x18, 0x10, 0x00, 0x00, 0x01, 0x01, 0x80, 0x00, 0x02, 0x07, 0x81, 0x00, 0x81, 0xF0, 0xE0, 0xF8, 0x1C, 0x10, 0x08, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x02, 0x07, 0xC3, 0x01, 0xC3, 0xF0, 0x60, 0xFC, 0x3E, 0x38, 0x08, 0x02, 0x03, 0x83, 0x80, 0x00, 0x07, 0x0F, 0xC1, 0x40, 0xC1, 0xF0, 0x71, 0xFC, 0x7C, 0x18, 0x18, 0x02, 0x07, 0xC1, 0x80, 0x01, 0x03, 0x07, 0xC1, 0x40, 0xE1, 0xF8, 0xE3, 0xFE, 0x3C, 0x1C, 0x1C, 0x07, 0x0F, 0xE3, 0xC0, 0x01, 0x03, 0x87, 0xE3, 0xC1, 0xC3, 0xFC, 0x61, 0xFC, 0x7E, 0x38, 0x3E, 0x0F, 0x07, 0xC3, 0xC0, 0x03, 0x07, 0x0F, 0xF1, 0xE0, 0xC1, 0xF8, 0xF1, 0xFE, 0xFE, 0x18, 0x7C, 0x07, 0x87, 0xE3, 0xC4, 0x03, 0x83, 0x07, 0xE3, 0xF1, 0xE1, 0xF8, 0xF3, 0xFF, 0x7F, 0x3C, 0x3C, 0x07, 0x0F, 0xE7, 0xE4, 0x07, 0xC7, 0x87, 0xE3, 0xE1, 0xE3, 0xF8, 0xF7, 0xFE, 0x7E, 0x3C, 0x7E, 0x0F, 0x1F, 0xEF, 0xEE, 0x0F, 0x87, 0x8F, 0xE3, 0xE1, 0xE3, 0xFD, 0xFB, 0xFE, 0xFF, 0x3C, 0xFE, 0x0F, 0x8F, 0xE7, 0xE7, 0x07, 0x87, 0x8F, 0xF7, 0xF3, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x7F, 0x1F, 0x8F, 0xEF, 0xEE, 0x0F, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0x0F, 0x9F, 0xF7, 0xDE, 0x1F, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x0F, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFE, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0x8F, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFD, 0xFF, 0x7E, 0xFF, 0x8F, 0xDF, 0xF7, 0xDF, 0x1F, 0xEF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0x7E, 0xFF, 0x0F, 0xBF, 0xF7, 0xEF, 0x1F, 0xEF, 0xDF, 0xEF, 0xFD, 0xFB, 0xFD, 0xFB, 0xFC, 0xFE, 0xFF, 0x7F, 0x1F, 0xDF, 0xEF, 0xEF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFB, 0xFB, 0xFF, 0x7E, 0xFF, 0x9F, 0xDF, 0xDF, 0xDF, 0xDF, 0xEF, 0xDF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFD, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0xDF, 0x9F, 0xEF, 0xDF, 0xEF, 0xFD, 0xFB, 0xF7, 0xFE, 0xFD, 0xFE, 0xFF, 0x7F, 0xDF, 0xEF, 0xFF, 0xBF, 0xBF, 0xF7, 0xEF, 0xDF, 0xFD, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFF, 0xFF, 0xDF, 0xDF, 0xF7, 0xF7, 0xEF, 0xFE, 0xFB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFB, 0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xBF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xBF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xE8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0xF3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xE3, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFB, 0xFF, 0xF5, 0xFF, 0xFF, 0xA4, 0x02, 0xBF, 0xC0, 0x21, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x80, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x82, 0x01, 0x01, 0xC0, 0x81, 0xF0, 0x10, 0x20, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x04, 0x07, 0x02, 0x01, 0x03, 0xC0, 0x83, 0xF8, 0x30, 0x20, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x0F, 0x02, 0x01, 0x03, 0xE1, 0xC1, 0xF0, 0x38, 0x20, 0x10, 0x00, 0x07, 0x03, 0x80, 0x00, 0x04, 0x0F, 0x87, 0x03, 0x87, 0xE0, 0xC1, 0xF8, 0x7C, 0x70, 0x10, 0x04, 0x07, 0x07, 0x00, 0x00, 0x0E, 0x1F, 0x83, 0x81, 0x83, 0xE0, 0xE3, 0xF8, 0xF8, 0x30, 0x30, 0x04, 0x0F, 0x83, 0x00, 0x02, 0x06, 0x0F, 0x83, 0x81, 0xC3, 0xF1, 0xC7, 0xFC, 0x78, 0x38, 0x38, 0x0E, 0x1F, 0xC7, 0x80, 0x02, 0x07, 0x0F, 0xC7, 0x83, 0x87, 0xF8, 0xC3, 0xF8, 0xFC, 0x70, 0x7C, 0x1E, 0x0F, 0x87, 0x80, 0x06, 0x0E, 0x1F, 0xE3, 0xC1, 0x83, 0xF1, 0xE3, 0xFD, 0xFC, 0x30, 0xF8, 0x0F, 0x0F, 0xC7, 0x88, 0x07, 0x06, 0x0F, 0xC7, 0xE3, 0xC3, 0xF1, 0xE7, 0xFE, 0xFE, 0x78, 0x78, 0x0E, 0x1F, 0xCF, 0xC8, 0x0F, 0x8F, 0x0F, 0xC7, 0xC3, 0xC7, 0xF1, 0xEF, 0xFC, 0xFC, 0x78, 0xFC, 0x1E, 0x3F, 0xDF, 0xDC, 0x1F, 0x0F, 0x1F, 0xC7, 0xC3, 0xC7, 0xFB, 0xF7, 0xFD, 0xFE, 0x79, 0xFC, 0x1F, 0x1F, 0xCF, 0xCE, 0x0F, 0x0F, 0x1F, 0xEF, 0xE7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0xFE, 0x3F, 0x1F, 0xDF, 0xDC, 0x1F, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFB, 0xFD, 0xFE, 0xFC, 0x1F, 0x3F, 0xEF, 0xBC, 0x3F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x1F, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xFD, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x1F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xFB, 0xFE, 0xFD, 0xFF, 0x1F, 0xBF, 0xEF, 0xBE, 0x3F, 0xDF, 0xBF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFD, 0xFE, 0x1F, 0x7F, 0xEF, 0xDE, 0x3F, 0xDF, 0xBF, 0xDF, 0xFB, 0xF7, 0xFB, 0xF7, 0xF9, 0xFD, 0xFE, 0xFE, 0x3F, 0xBF, 0xDF, 0xDF, 0x7F, 0xEF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xF7, 0xF7, 0xFE, 0xFD, 0xFF, 0x3F, 0xBF, 0xBF, 0xBF, 0xBF, 0xDF, 0xBF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFD, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0x3F, 0xDF, 0xBF, 0xDF, 0xFB, 0xF7, 0xEF, 0xFD, 0xFB, 0xFD, 0xFE, 0xFF, 0xBF, 0xDF, 0xFF, 0x7F, 0x7F, 0xEF, 0xDF, 0xBF, 0xFB, 0xFB, 0xF7, 0xFB, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0xBF, 0xEF, 0xEF, 0xDF, 0xFD, 0xF7, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFF, 0x7F, 0xFF, 0xFF, 0xBF, 0x3F, 0xF7, 0xDF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0x7E, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x7F, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEF, 0xFF, 0xD7, 0xFF, 0xFE, 0x90, 0x0A, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC1, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x02, 0x03, 0x81, 0x03, 0xE0, 0x20, 0x40, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x08, 0x0E, 0x04, 0x02, 0x07, 0x81, 0x07, 0xF0, 0x60, 0x40, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08, 0x1E, 0x04, 0x02, 0x07, 0xC3, 0x83, 0xE0, 0x70, 0x40, 0x20, 0x00, 0x0E, 0x07, 0x00, 0x00, 0x08, 0x1F, 0x0E, 0x07, 0x0F, 0xC1, 0x83, 0xF0, 0xF8, 0xE0, 0x20, 0x08, 0x0E, 0x0E, 0x00, 0x00, 0x1C, 0x3F, 0x06, 0x03, 0x07, 0xC1, 0xC7, 0xF1, 0xF0, 0x60, 0x60, 0x08, 0x1F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x07, 0x03, 0x87, 0xE3, 0x8F, 0xF8, 0xF0, 0x70, 0x70, 0x1C, 0x3F, 0x8F, 0x00, 0x04, 0x0E, 0x1F, 0x8E, 0x07, 0x0F, 0xF1, 0x87, 0xF1, 0xF8, 0xE0, 0xF8, 0x3C, 0x1F, 0x0F, 0x00, 0x0C, 0x1C, 0x3F, 0xC6, 0x83, 0x07, 0xE3, 0xC7, 0xFB, 0xF8, 0x61, 0xF0, 0x1E, 0x1F, 0x8F, 0x10, 0x0E, 0x0C, 0x1F, 0x8F, 0xC7, 0x87, 0xE3, 0xCF, 0xFD, 0xFC, 0xF0, 0xF0, 0x1C, 0x3F, 0x9F, 0x90, 0x1F, 0x1E, 0x1F, 0x8F, 0x87, 0x8F, 0xE3, 0xDF, 0xF9, 0xF8, 0xF1, 0xF8, 0x3C, 0x7F, 0xBF, 0xB8, 0x3E, 0x1E, 0x3F, 0x8F, 0x87, 0x8F, 0xF7, 0xEF, 0xFB, 0xFC, 0xF3, 0xF8, 0x3E, 0x3F, 0x9F, 0x9C, 0x1E, 0x1E, 0x3F, 0xDF, 0xCF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xF9, 0xFC, 0x7E, 0x3F, 0xBF, 0xB8, 0x3F, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFD, 0xF8, 0x3E, 0x7F, 0xDF, 0x78, 0x7F, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x3F, 0xBF, 0x7F, 0xBF, 0xDF, 0xEF, 0xF7, 0xEF, 0xFB, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0x3F, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFB, 0xFE, 0x3F, 0x7F, 0xDF, 0x7C, 0x7F, 0xBF, 0x7F, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xFD, 0xFB, 0xFC, 0x3E, 0xFF, 0xDF, 0xBC, 0x7F, 0xBF, 0x7F, 0xBF, 0xF7, 0xEF, 0xF7, 0xEF, 0xF3, 0xFB, 0xFD, 0xFC, 0x7F, 0x7F, 0xBF, 0xBE, 0xFF, 0xDF, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xEF, 0xEF, 0xFD, 0xFB, 0xFE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xBF, 0x7F, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFB, 0xFE, 0xFF, 0x7F, 0xBF, 0x7E, 0x7F, 0xBF, 0x7F, 0xBF, 0xF7, 0xEF, 0xDF, 0xFB, 0xF7, 0xFB, 0xFD, 0xFF, 0x7F, 0xBF, 0xFE, 0xFE, 0xFF, 0xDF, 0xBF, 0x7F, 0xF7, 0xF7, 0xEF, 0xF7, 0xEF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xDF, 0xDF, 0xBF, 0xFB, 0xEF, 0xFF, 0xFF, 0xF7, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0x7E, 0x7F, 0xEF, 0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x7F, 0xFF, 0xFE, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFB, 0xFF, 0x7F, 0xFF, 0xFE, 0xFE, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFE, 0xFF, 0xEF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x08, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x00, 0x0E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xBF, 0xFF, 0x5D, 0xFF, 0xFA, 0x40, 0x2B, 0xFF, 0x82, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xAB, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7 },
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x82, 0x03, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x04, 0x07, 0x02, 0x07, 0xC0, 0x40, 0x80, 0x00, 0x00, 0x08, 0x1C, 0x00, 0x00, 0x10, 0x1C, 0x08, 0x04, 0x0F, 0x02, 0x0F, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x08, 0x0C, 0x00, 0x00, 0x10, 0x3C, 0x08, 0x04, 0x0F, 0x87, 0x07, 0xC0, 0xE0, 0x80, 0x40, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x10, 0x3E, 0x1C, 0x0E, 0x1F, 0x83, 0x07, 0xE1, 0xF1, 0xC0, 0x40, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x38, 0x7E, 0x0C, 0x06, 0x0F, 0x83, 0x8F, 0xE3, 0xE0, 0xC0, 0xC0, 0x10, 0x3E, 0x0C, 0x00, 0x08, 0x18, 0x3E, 0x0E, 0x07, 0x0F, 0xC7, 0x1F, 0xF1, 0xE0, 0xE0, 0xE0, 0x38, 0x7F, 0x1E, 0x00, 0x08, 0x1C, 0x3F, 0x1C, 0x0E, 0x1F, 0xE3, 0x0F, 0xE3, 0xF1, 0xC1, 0xF0, 0x78, 0x3E, 0x1E, 0x00, 0x18, 0x38, 0x7F, 0x8C, 0x06, 0x0F, 0xC7, 0x8F, 0xF7, 0xF0, 0xC3, 0xE0, 0x3C, 0x3F, 0x1E, 0x20, 0x1C, 0x18, 0x3F, 0x1E, 0x8F, 0x0F, 0xC7, 0x9F, 0xFB, 0xF9, 0xE1, 0xE0, 0x38, 0x7F, 0x3F, 0x20, 0x3E, 0x3C, 0x3F, 0x1E, 0x0F, 0x1F, 0xC7, 0xBF, 0xF3, 0xF1, 0xE3, 0xF0, 0x78, 0xFF, 0x7F, 0x70, 0x7C, 0x3C, 0x7F, 0x1E, 0x0F, 0x1F, 0xEF, 0xDF, 0xF7, 0xF9, 0xE7, 0xF0, 0x7C, 0x7F, 0x3F, 0x38, 0x3C, 0x3C, 0x7F, 0xBF, 0x9F, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF3, 0xF8, 0xFC, 0x7F, 0x7F, 0x70, 0x7E, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF0, 0x7C, 0xFF, 0xBE, 0xF0, 0xFE, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0x7F, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xEF, 0xDF, 0xF7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7C, 0x7E, 0xFF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xEF, 0xFB, 0xF7, 0xFC, 0x7E, 0xFF, 0xBE, 0xF8, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0xF7, 0xF8, 0x7D, 0xFF, 0xBF, 0x78, 0xFF, 0x7E, 0xFF, 0x7F, 0xEF, 0xDF, 0xEF, 0xDF, 0xE7, 0xF7, 0xFB, 0xF8, 0xFE, 0xFF, 0x7F, 0x7D, 0xFF, 0xBF, 0x7F, 0xBF, 0xDF, 0xBF, 0xEF, 0xDF, 0xDF, 0xFB, 0xF7, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x7E, 0xFF, 0xBF, 0xDF, 0xBF, 0xDF, 0xEF, 0xEF, 0xFB, 0xF7, 0xFD, 0xFE, 0xFF, 0x7E, 0xFC, 0xFF, 0x7E, 0xFF, 0x7F, 0xEF, 0xDF, 0xBF, 0xF7, 0xEF, 0xF7, 0xFB, 0xFE, 0xFF, 0x7F, 0xFD, 0xFD, 0xFF, 0xBF, 0x7E, 0xFF, 0xEF, 0xEF, 0xDF, 0xEF, 0xDF, 0xEF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBF, 0xBF, 0x7F, 0xF7, 0xDF, 0xFF, 0xFF, 0xEF, 0xF7, 0xF7, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xDF, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF7, 0xFE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF9, 0x81, 0xFF, 0xFF, 0x7F, 0xFF, 0xFB, 0xFD, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF0, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0x60, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0xEA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0xEA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x63, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0xF6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xE6, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x46, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0x00, 0x06, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xFF, 0xFD, 0x77, 0xFF, 0xE9, 0x00, 0xAF, 0xFE, 0x08, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBE, 0xAF, 0xF8, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF },
-};
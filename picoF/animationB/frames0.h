@@ -1,10 +0,0 @@
-#ifndef FRAMES0_H
-#define FRAMES0_H
-
-#define FRAME_WIDTH  128
-#define FRAME_HEIGHT 64
-#define FRAME_COUNT  102
-
-extern const unsigned char frames0[FRAME_COUNT][1024];
-
-#endif
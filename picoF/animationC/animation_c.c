@@ -1,72 +1,9 @@
 // animation_c.c
-// Animation C: Frame-based pixel art player for SSD1306
-// - Consumes frames[] from frames.h (generated from PBM files)
-// - Exits cleanly on universal exit combo
-// - Includes both FPS-locked and time-based playback (time-based commented out)
+// Animation C: the "animation_c" clip (animationC/frames/*.pbm, packed by
+// picoF_add_asset_pack) on the shared clip player, see anim/anim_player.h
 
-#include <stdint.h>
-#include <stdbool.h>
-#include <string.h>
-#include "animationC/frames.h" // Generated: provides frames[], FRAME_COUNT, FRAME_WIDTH, FRAME_HEIGHT
-#include "registry.h"          // For REGISTER_PROGRAM
-#include "pico/stdlib.h"       // For sleep_ms, absolute_time, etc.
-#include "input/input.h"       // For input_update(), exit_combo_triggered()
+#include "animationC/animation_c.h"
+#include "anim_player.h"
 
-// External hooks from your platform
-extern void oled_present_mono_1bpp(const uint8_t* fb, int width, int height);
-
-// Local framebuffer (matches display size)
-static uint8_t s_fb[FRAME_WIDTH * (FRAME_HEIGHT / 8)];
-
-static inline void fb_clear(void) { memset(s_fb, 0, sizeof(s_fb)); }
-static inline void fb_blit_frame(const uint8_t* src) { memcpy(s_fb, src, sizeof(s_fb)); }
-
-void run_animation_c(void) {
-    fb_clear();
-    oled_present_mono_1bpp(s_fb, FRAME_WIDTH, FRAME_HEIGHT);
-    int frame = 0;
-
-    // ===== FPS-LOCKED PLAYBACK =====
-    const int FRAME_DELAY_MS = 100; // 10 FPS
-    while (true) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        input_update(now);
-        if (exit_combo_triggered()) {
-            fb_clear();
-            oled_present_mono_1bpp(s_fb, FRAME_WIDTH, FRAME_HEIGHT);
-            return;
-        }
-
-        fb_blit_frame(frames[frame]);
-        oled_present_mono_1bpp(s_fb, FRAME_WIDTH, FRAME_HEIGHT);
-        frame = (frame + 1) % FRAME_COUNT;
-        sleep_ms(FRAME_DELAY_MS);
-    }
-
-    /* ===== TIME-BASED PLAYBACK =====
-    const int TARGET_FPS = 10;
-    const int FRAME_INTERVAL_MS = 1000 / TARGET_FPS;
-    absolute_time_t last_time = get_absolute_time();
-    while (true) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        input_update(now);
-        if (exit_combo_triggered()) {
-            fb_clear();
-            oled_present_mono_1bpp(s_fb, FRAME_WIDTH, FRAME_HEIGHT);
-            return;
-        }
-
-        absolute_time_t cur_time = get_absolute_time();
-        int elapsed_ms = to_ms_since_boot(cur_time) - to_ms_since_boot(last_time);
-        if (elapsed_ms >= FRAME_INTERVAL_MS) {
-            last_time = cur_time;
-            fb_blit_frame(frames[frame]);
-            oled_present_mono_1bpp(s_fb, FRAME_WIDTH, FRAME_HEIGHT);
-            frame = (frame + 1) % FRAME_COUNT;
-        }
-        sleep_ms(1);
-    }
-    */
-}
-
-REGISTER_PROGRAM(animation_c, "Animation C", NULL);
+// Small enough (~8 KB) to play from SRAM
+REGISTER_CLIP(animation_c, "Animation C", "animation_c", .default_ms = 100, .prefetch = true);
@@ -1,88 +0,0 @@
-#include "frames.h"
-
-const unsigned char frames[FRAME_COUNT][1024] = {
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x21, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x83, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x21, 0x00, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x82, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x13, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x88, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x08, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x10, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x01, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x10, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x10, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x14, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x10, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x21, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x08, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x01, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x6D, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x14, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x6D, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0x31, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x20, 0x40, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x6D, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x21, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x82, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0A, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x80, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x08, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x80, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x81, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9E, 0xA0, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9A, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x90, 0xA0, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x94, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9E, 0xA0, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x0B, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0xA4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x02, 0xAB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x8A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x82, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x83, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x82, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x83, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x21, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x83, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x21, 0x00, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x82, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x13, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x88, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x08, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x10, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x01, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x10, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x10, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x14, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x10, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x08, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x01, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x14, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x20, 0x40, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x82, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0A, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x80, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x08, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x80, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x81, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9E, 0xA0, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9A, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x90, 0xA0, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x94, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9E, 0xA0, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x0B, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0xA4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x02, 0xAB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x8A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x82, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x83, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x82, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x83, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x21, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x83, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x21, 0x00, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x82, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x13, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x88, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x08, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x10, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x01, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x10, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x10, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x14, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x10, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x08, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x08, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x01, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xF0, 0x00, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x7E, 0x00, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x24, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x04, 0x14, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x40, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x40, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x40, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x40, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x0F, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xF0, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x44, 0x1F, 0x00, 0x07, 0xC1, 0x10, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x01, 0x00, 0x10, 0xF8, 0x00, 0x00, 0xF8, 0x40, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x23, 0xD0, 0x00, 0x00, 0x1F, 0x20, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x80, 0x01, 0x00, 0x20, 0x00, 0x20, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x01, 0x00, 0x70, 0x00, 0x20, 0x40, 0x47, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x01, 0x00, 0xF8, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0xA8, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x40, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x40, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x40, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBE, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7F, 0xF0, 0x48, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x43, 0xF0, 0x7E, 0x10, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x44, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x05, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x20, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x31, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02, 0x22, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x89, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x01, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x01, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x01, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x01, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x40, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x40, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x47, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x40, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x40, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x43, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x40, 0x0F, 0x80, 0x10, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x04, 0x7F, 0xF1, 0x00, 0x08, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x00, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x08, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x50, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x10, 0x00, 0x00, 0x70, 0x20, 0x08, 0x40, 0x87, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0xF8, 0x20, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x88, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x21, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x02, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x80, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x80, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x02, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x04, 0x21, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xBA, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBD, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x10, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x16, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0x10, 0x00, 0x81, 0x43, 0xF0, 0x7E, 0x14, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x80, 0x5F, 0x00, 0x07, 0xD0, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x01, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x02, 0x08, 0x05, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x20, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x22, 0x20, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x88, 0x20, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x10, 0x00, 0x00, 0xA8, 0x20, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x80, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x80, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x80, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x04, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08, 0x7F, 0xF0, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x1F, 0x00, 0x07, 0xC1, 0x04, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x83, 0xD0, 0x00, 0x00, 0x1F, 0x08, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x82, 0x10, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x10, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x80, 0x20, 0x00, 0x40, 0x00, 0x00, 0x30, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x20, 0x70, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0xF8, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x02, 0x08, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x02, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x23, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x10, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x10, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x80, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x20, 0xF8, 0x00, 0x00, 0xF8, 0x20, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x90, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0A, 0x17, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x81, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x23, 0xFE, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x80, 0x22, 0x22, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x80, 0x20, 0x88, 0x40, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x80, 0x20, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x10, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x10, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x10, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x80, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0D, 0x83, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x87, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x80, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x82, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x20, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x20, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x80, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x50, 0x80, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x87, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7D, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x20, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x04, 0x00, 0x70, 0x40, 0x00, 0x04, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xF8, 0x40, 0x00, 0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x04, 0x01, 0xFC, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x04, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x04, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x01, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x40, 0xFC, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x21, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x20, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x41, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x08, 0xBE, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x03, 0xF0, 0x7E, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x07, 0xC0, 0x10, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x10, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x40, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x40, 0x51, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x50, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x04, 0x00, 0xA8, 0x40, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x04, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x05, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x04, 0x08, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x20, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x11, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0xA4, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0xF8, 0x00, 0x00, 0xF8, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x43, 0xD0, 0x00, 0x00, 0x1F, 0x10, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x3E, 0x80, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x08, 0xF0, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x07, 0x80, 0x80, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x08, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x03, 0xFE, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x80, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x08, 0x00, 0x02, 0x22, 0x00, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x90, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x43, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x04, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x04, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0x24, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x00, 0x07, 0xC0, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x81, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x21, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x04, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0x11, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x08, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9E, 0xA0, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9A, 0xA0, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x08, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x90, 0xA0, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x08, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x94, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9E, 0xA0, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x12, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x04, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x13, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x00, 0x02, 0x22, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xA8, 0x04, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x04, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x00, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x10, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x00, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x10, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x0B, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0xA4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x02, 0xAB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x88, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x8A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x03, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x02, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x03, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x17, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-    { 0x7C, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00, 0x40, 0x04, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x07, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x04, 0x00, 0x07, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x70, 0x20, 0x00, 0x00, 0x07, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x60, 0x00, 0x40, 0x02, 0x22, 0x00, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x28, 0x00, 0xD1, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0xA8, 0x08, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x03, 0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x54, 0x02, 0x00, 0x08, 0x00, 0x7C, 0x40, 0x00, 0x00, 0xA8, 0x04, 0x7C, 0x04, 0x10, 0x8F, 0xE0, 0x44, 0x02, 0xF3, 0xCB, 0x80, 0x7C, 0x40, 0x00, 0x00, 0x88, 0x03, 0xE0, 0x04, 0x10, 0x80, 0x20, 0x38, 0x02, 0x05, 0x6B, 0x80, 0x7C, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3B, 0xEE, 0x80, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x7C, 0x40, 0x00, 0x00, 0x88, 0xF8, 0x00, 0x24, 0x12, 0x9F, 0x20, 0x00, 0x02, 0xD5, 0x6B, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x21, 0x82, 0x9B, 0x20, 0x00, 0x02, 0xD6, 0xAB, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x23, 0x42, 0x91, 0x20, 0x00, 0x02, 0xD3, 0xCB, 0xA8, 0x10, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x35, 0xAA, 0x95, 0x20, 0x00, 0x02, 0x00, 0x0B, 0xA8, 0x18, 0x00, 0x00, 0x07, 0xC8, 0x00, 0x0E, 0x3F, 0xFE, 0x9F, 0x20, 0x00, 0x03, 0xFF, 0xFB, 0xA8, 0x7C, 0x00, 0x00, 0x3E, 0x88, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF1, 0x08, 0x1F, 0xF4, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0x07, 0xC1, 0x08, 0x1F, 0xF2, 0x40, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x20, 0x3E, 0x02, 0x10, 0x00, 0x01, 0xE0, 0xF0, 0x87, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x7C, 0x00, 0xFF, 0xFC, 0x10, 0xFF, 0xC0, 0x90, 0xF8, 0x80, 0x20, 0x20, 0x01, 0x00, 0x00, 0x08, 0x0C, 0x03, 0xF0, 0xC8, 0x20, 0xD4, 0xC0, 0x58, 0xF4, 0xFC, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x3E, 0x40, 0xC8, 0x40, 0xFF, 0xC0, 0x30, 0xF8, 0x03, 0xEB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x80, 0xC9, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x20, 0x00, 0x7F, 0x00, 0x00, 0x7D, 0xC1, 0x03, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x0A, 0xA0, 0x00, 0x80, 0x80, 0x00, 0x11, 0x01, 0x04, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x70, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x01, 0x00, 0x40, 0x00, 0x10, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x20, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x01, 0x25, 0xA0, 0x00, 0x7C, 0x02, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x80, 0x00, 0xB5, 0x20, 0x00, 0x7C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x7C, 0x10, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x44, 0x60, 0x00, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x00, 0x39, 0x40, 0x00, 0x05, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x82, 0x44, 0x01, 0x83, 0x00, 0x00, 0x05, 0x1F, 0xE4, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x06, 0x80, 0x83, 0xFE, 0x03, 0x0B, 0x00, 0x00, 0x0D, 0x10, 0x24, 0x0B, 0xC0, 0x00, 0x00, 0x4C, 0x06, 0xC0, 0x82, 0x42, 0x00, 0xDC, 0x00, 0x00, 0x7D, 0x14, 0xA4, 0x07, 0xC3, 0x80, 0x00, 0x0C, 0x06, 0x00, 0x01, 0xBA, 0xFE, 0xC1, 0xFF, 0xC0, 0x61, 0x00, 0x04, 0x03, 0xC0, 0xCA, 0xA9, 0x0B, 0xFA, 0x00, 0x83, 0x82, 0x00, 0x10, 0x00, 0xE0, 0x61, 0x1F, 0xE4, 0x7C, 0x3E, 0xDB, 0xEF, 0x08, 0x02, 0x00, 0x03, 0xB5, 0x29, 0x7E, 0xA6, 0xE0, 0x61, 0x10, 0x25, 0xFF, 0xFE, 0xFB, 0xFF, 0x08, 0x02, 0x00, 0x03, 0xBB, 0x7B, 0x7F, 0xB6, 0xE0, 0x7D, 0x12, 0x24, 0x00, 0x00, 0xFF, 0xEF, 0x1F, 0xFF, 0x80, 0x03, 0xBF, 0xF7, 0x7F, 0xBE, 0xE0, 0x7D, 0x15, 0x24, 0x00, 0x03, 0xEF, 0xFF, 0x20, 0x08, 0x80, 0x03, 0xBF, 0xFF, 0x7F, 0xFE, 0xE0, 0x7D, 0x15, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x08, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x7D, 0x13, 0x24, 0x00, 0x01, 0x3B, 0xFF, 0x20, 0x08, 0x80, 0x03, 0x3F, 0xFB, 0x7F, 0xFE, 0x60, 0x7D, 0x18, 0x64, 0x00, 0x03, 0x9F, 0xFF, 0x20, 0x08, 0x8F, 0xF6, 0xBF, 0xF3, 0x7F, 0xFE, 0xF0, 0x61, 0x07, 0x84, 0x00, 0x03, 0x8F, 0x7F, 0x20, 0x08, 0x88, 0x17, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x61, 0x00, 0x04, 0x00, 0x03, 0x87, 0xFF, 0x20, 0x08, 0x89, 0x15, 0xBF, 0xFF, 0xFF, 0xFE, 0xD0, 0x1C, 0xC0, 0x18, 0x00, 0x01, 0x01, 0xEF, 0x26, 0x48, 0x99, 0x15, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x0C, 0x60, 0x30, 0x00, 0x03, 0x80, 0x3D, 0x20, 0x08, 0xAA, 0x16, 0xBF, 0xD3, 0x7D, 0x7E, 0xD0, 0x0C, 0x5F, 0xD0, 0x00, 0x07, 0xC0, 0x0F, 0x20, 0x08, 0xA4, 0x26, 0xB7, 0xCF, 0x7D, 0xFE, 0xB0, 0x7C, 0x40, 0x10, 0x00, 0x0F, 0xE0, 0x01, 0x20, 0x08, 0xBC, 0x27, 0xBB, 0xEF, 0x7F, 0xFE, 0xF0, 0x7C, 0x80, 0x08, 0x00, 0x1C, 0x70, 0x00, 0x3F, 0xFF, 0x87, 0xE7, 0xAB, 0xFF, 0x7D, 0xFE, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
-};
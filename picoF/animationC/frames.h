@@ -1,10 +0,0 @@
-#ifndef FRAMES_H
-#define FRAMES_H
-
-#define FRAME_WIDTH  128
-#define FRAME_HEIGHT 64
-#define FRAME_COUNT  84
-
-extern const unsigned char frames[FRAME_COUNT][1024];
-
-#endif
@@ -0,0 +1,75 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Asset pack layout, shared by the firmware (assets.h) and tools/assetc.
+// The pack is flashed on its own to a fixed region and read in place
+// through XIP. Little-endian; every asset starts 4-byte aligned.
+//
+//   asset_pack_header_t
+//   asset_entry_t[count]       sorted by name (strcmp), for binary search
+//   asset data
+//
+// CRC-32s (IEEE, as zlib): the header's covers the index and each entry's
+// its data, so a partly written pack is caught without reading all of it
+// at mount; an asset is checked the first time it is looked up.
+
+#define ASSET_PACK_MAGIC   0x50414650u     // "PFAP"
+#define ASSET_PACK_VERSION 1
+#define ASSET_NAME_MAX     16              // Including the NUL
+#define ASSET_MAX_COUNT    256
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;              // Whole pack in bytes
+    uint32_t crc32;             // Of the index
+} asset_pack_header_t;
+
+typedef enum {
+    ASSET_RAW = 0,              // Opaque bytes
+    ASSET_CLIP,                 // asset_clip_header_t + anim_codec.h stream
+    ASSET_BITMAP,               // asset_bitmap_header_t + page-major 1bpp
+} asset_type_t;
+
+typedef enum {
+    ASSET_STORED = 0,           // Used as is
+    ASSET_ANIM_RLE,             // anim_codec.h key/delta + RLE chunks
+} asset_compression_t;
+
+typedef struct {
+    char name[ASSET_NAME_MAX];  // NUL padded
+    uint8_t type;               // asset_type_t
+    uint8_t compression;        // asset_compression_t
+    uint16_t reserved;
+    uint32_t offset;            // From the start of the pack
+    uint32_t size;
+    uint32_t crc32;             // Of the data
+} asset_entry_t;
+
+// ASSET_CLIP body: the header, then
+//   uint32_t offsets[frame_count + 1]
+//   uint16_t durations[frame_count]     (ms)
+//   chunk data (offsets[frame_count] bytes)
+typedef struct {
+    uint16_t width, height;
+    uint16_t frame_count;
+    uint16_t frame_bytes;
+} asset_clip_header_t;
+
+// ASSET_BITMAP body: the header, then width * height / 8 bytes
+typedef struct {
+    uint16_t width, height;
+} asset_bitmap_header_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,189 @@
+#include "assets.h"
+#include <stdio.h>
+#include <string.h>
+#include "hardware_config.h"
+
+#if PICOF_HOST
+#include "host_hal.h"
+#define FLASH_REGION() host_asset_flash()
+#else
+#include "hardware/regs/addressmap.h"
+#define FLASH_REGION() ((const uint8_t*)(XIP_BASE + ASSET_PACK_OFFSET))
+extern char __flash_binary_end;     // From the SDK linker script
+#endif
+
+static const asset_pack_header_t* s_pack;
+static const asset_entry_t* s_index;
+static bool s_checked;
+
+// Entries whose data CRC has been checked, and the result
+static uint32_t s_crc_done[ASSET_MAX_COUNT / 32], s_crc_ok[ASSET_MAX_COUNT / 32];
+
+// Prefetched copies: index entry -> SRAM, bump allocated
+#define ASSET_PREFETCH_MAX 8
+
+static uint8_t s_pool[ASSET_SRAM_POOL] __attribute__((aligned(4)));
+static uint32_t s_pool_used;
+static struct {
+    const asset_entry_t* entry;
+    const uint8_t* copy;
+} s_prefetched[ASSET_PREFETCH_MAX];
+static int s_prefetch_count;
+
+// CRC-32 (reflected, poly 0xEDB88320) a nibble at a time: a 64-byte table
+// instead of 1 KB, for checks that run once per mount
+static uint32_t crc32(const uint8_t* p, uint32_t n) {
+    static const uint32_t nibble[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    uint32_t crc = 0xFFFFFFFFu;
+    while (n--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ nibble[crc & 15];
+        crc = (crc >> 4) ^ nibble[crc & 15];
+    }
+    return ~crc;
+}
+
+static bool reject(const char* why) {
+    printf("assets: no pack at flash offset 0x%lx (%s)\n", (unsigned long)ASSET_PACK_OFFSET, why);
+    return false;
+}
+
+bool assets_init(void) {
+    s_checked = true;
+    s_pack = NULL;
+    s_index = NULL;
+    s_pool_used = 0;
+    s_prefetch_count = 0;
+    memset(s_crc_done, 0, sizeof(s_crc_done));
+
+#if !PICOF_HOST
+    // A firmware image that grew into the region would be read as a pack
+    if ((uintptr_t)&__flash_binary_end > XIP_BASE + ASSET_PACK_OFFSET) return reject("firmware overlaps it");
+#endif
+    const uint8_t* base = FLASH_REGION();
+    if (!base) return reject("not found");
+    const asset_pack_header_t* h = (const asset_pack_header_t*)base;
+    if (h->magic != ASSET_PACK_MAGIC) return reject("bad magic");
+    if (h->version != ASSET_PACK_VERSION) return reject("unsupported version");
+    if (h->count > ASSET_MAX_COUNT) return reject("too many assets");
+    uint32_t index_end = sizeof(*h) + (uint32_t)h->count * sizeof(asset_entry_t);
+    if (h->size < index_end || h->size > ASSET_PACK_SIZE) return reject("bad size");
+    if (crc32(base + sizeof(*h), index_end - sizeof(*h)) != h->crc32) return reject("CRC mismatch");
+
+    const asset_entry_t* index = (const asset_entry_t*)(base + sizeof(*h));
+    for (uint16_t i = 0; i < h->count; i++) {
+        const asset_entry_t* e = &index[i];
+        if (e->name[ASSET_NAME_MAX - 1] || e->offset < index_end || e->offset & 3 ||
+            e->size > h->size - e->offset)
+            return reject("bad index");
+    }
+
+    s_pack = h;
+    s_index = index;
+    return true;
+}
+
+bool assets_ready(void) {
+    if (!s_checked) assets_init();
+    return s_pack != NULL;
+}
+
+// Check entry i's data on its first lookup
+static bool intact(int i) {
+    uint32_t bit = 1u << (i & 31);
+    if (!(s_crc_done[i / 32] & bit)) {
+        const asset_entry_t* e = &s_index[i];
+        s_crc_done[i / 32] |= bit;
+        if (crc32((const uint8_t*)s_pack + e->offset, e->size) == e->crc32) {
+            s_crc_ok[i / 32] |= bit;
+        } else {
+            s_crc_ok[i / 32] &= ~bit;
+            printf("assets: %s fails its CRC\n", e->name);
+        }
+    }
+    return s_crc_ok[i / 32] & bit;
+}
+
+const asset_entry_t* asset_find(const char* name) {
+    if (!assets_ready()) return NULL;
+    int lo = 0, hi = (int)s_pack->count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int c = strncmp(name, s_index[mid].name, ASSET_NAME_MAX);
+        if (!c) return intact(mid) ? &s_index[mid] : NULL;
+        if (c < 0) hi = mid - 1;
+        else lo = mid + 1;
+    }
+    return NULL;
+}
+
+const void* asset_data(const asset_entry_t* e) {
+    for (int i = 0; i < s_prefetch_count; i++)
+        if (s_prefetched[i].entry == e) return s_prefetched[i].copy;
+    return (const uint8_t*)s_pack + e->offset;
+}
+
+bool asset_clip(const char* name, anim_stream_t* out) {
+    const asset_entry_t* e = asset_find(name);
+    if (!e || e->type != ASSET_CLIP || e->size < sizeof(asset_clip_header_t)) return false;
+
+    const uint8_t* p = asset_data(e);
+    const asset_clip_header_t* h = (const asset_clip_header_t*)p;
+    uint32_t tables = sizeof(*h) + ((uint32_t)h->frame_count + 1) * 4 + (uint32_t)h->frame_count * 2;
+    if (!h->frame_count || e->size < tables) return false;
+    // Frames decode into a width * height / 8 framebuffer
+    if (h->frame_bytes != (uint32_t)h->width * (h->height / 8)) return false;
+    const uint32_t* offsets = (const uint32_t*)(p + sizeof(*h));
+    if (offsets[h->frame_count] > e->size - tables) return false;
+
+    *out = (anim_stream_t){
+        .width = h->width,
+        .height = h->height,
+        .frame_count = h->frame_count,
+        .frame_bytes = h->frame_bytes,
+        .offsets = offsets,
+        .durations = (const uint16_t*)(offsets + h->frame_count + 1),
+        .data = p + tables,
+    };
+    return true;
+}
+
+const uint8_t* asset_bitmap(const char* name, uint16_t* width, uint16_t* height) {
+    const asset_entry_t* e = asset_find(name);
+    if (!e || e->type != ASSET_BITMAP || e->size < sizeof(asset_bitmap_header_t)) return NULL;
+
+    const uint8_t* p = asset_data(e);
+    const asset_bitmap_header_t* h = (const asset_bitmap_header_t*)p;
+    if (e->size - sizeof(*h) < (uint32_t)h->width * (h->height / 8)) return NULL;
+    if (width) *width = h->width;
+    if (height) *height = h->height;
+    return p + sizeof(*h);
+}
+
+bool asset_prefetch(const char* name) {
+    const asset_entry_t* e = asset_find(name);
+    if (!e) return false;
+    if (asset_data(e) != (const uint8_t*)s_pack + e->offset) return true;   // Already in SRAM
+
+    uint32_t size = (e->size + 3) & ~3u;
+    if (s_prefetch_count == ASSET_PREFETCH_MAX || size > sizeof(s_pool) - s_pool_used) return false;
+    uint8_t* copy = &s_pool[s_pool_used];
+    memcpy(copy, (const uint8_t*)s_pack + e->offset, e->size);
+    s_pool_used += size;
+    s_prefetched[s_prefetch_count].entry = e;
+    s_prefetched[s_prefetch_count].copy = copy;
+    s_prefetch_count++;
+    return true;
+}
+
+void assets_list(void) {
+    if (!assets_ready()) return;
+    for (uint16_t i = 0; i < s_pack->count; i++) {
+        const asset_entry_t* e = &s_index[i];
+        printf("asset,%s,%u,%u,%lu,%s\n", e->name, e->type, e->compression, (unsigned long)e->size,
+               asset_data(e) == (const uint8_t*)s_pack + e->offset ? "flash" : "sram");
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "asset_pack.h"
+#include "anim_codec.h"
+
+// Flash asset pack. Clips and bitmaps are built into a pack by assetc
+// (picoF_add_asset_pack in cmake/picoF.cmake) and flashed on their own to
+// ASSET_PACK_OFFSET, so changing an asset never relinks or reflashes the
+// firmware. Lookups return pointers straight into XIP-mapped flash; no
+// asset is copied unless it is prefetched.
+//
+// On the host the pack is read from the build tree (HOST_ASSET_PACK) into
+// a stand-in for the flash region.
+
+// Check the pack in flash (magic, version, bounds, CRC) and mount it. The
+// first lookup does this; call it again after writing a new pack. Drops
+// any prefetched copies.
+bool assets_init(void);
+
+// True if a valid pack is mounted (mounting it on the first call)
+bool assets_ready(void);
+
+// Entry by name, or NULL
+const asset_entry_t* asset_find(const char* name);
+
+// An entry's bytes: in SRAM if prefetched, otherwise in flash
+const void* asset_data(const asset_entry_t* e);
+
+// Clip by name as a decodable stream (pointers into the asset). False if
+// missing or not a clip.
+bool asset_clip(const char* name, anim_stream_t* out);
+
+// Bitmap by name: page-major 1bpp, width * height / 8 bytes. NULL if
+// missing or not a bitmap.
+const uint8_t* asset_bitmap(const char* name, uint16_t* width, uint16_t* height);
+
+// Copy a hot asset into the SRAM pool (ASSET_SRAM_POOL bytes, never freed)
+// so later lookups skip the XIP cache. False if it doesn't fit. Streams
+// already handed out keep pointing at flash.
+bool asset_prefetch(const char* name);
+
+// printf the index: asset,name,type,compression,size,where
+void assets_list(void);
+
+#endif // ASSETS_H
@@ -0,0 +1,233 @@
+// bench.c
+// Micro-benchmark suite, see bench.h. The cases are shared; the device
+// clock and the "Benchmark" program are at the bottom.
+
+#include <string.h>
+#include "bench/bench.h"
+#include "gfx/gfx.h"
+#include "ssd1306/ssd1306.h"
+#include "hardware_init.h"
+#include "animationA/animation_a.h"
+#include "assets.h"
+
+// ---- Cases ------------------------------------------------------------------
+// Each run(n) does n operations, stepping positions by coprime strides so
+// consecutive ops touch different bytes and pages.
+
+static const char* const s_sprite[8] = {
+    "..####..",
+    ".######.",
+    "##.##.##",
+    "########",
+    "##....##",
+    ".##..##.",
+    "..####..",
+    "...##...",
+};
+
+static uint8_t s_spr_bits[GFX_SPRITE_BYTES(8, 8)];
+static gfx_sprite_t s_spr;
+
+static void b_gfx_plot(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_plot((int)(i * 37u) & 127, (int)(i * 13u) & 63, i & 1);
+}
+
+static void b_gfx_hline(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_hline((int)(i * 5u) & 63, (int)(i * 13u) & 63, 64, i & 1);
+}
+
+static void b_gfx_fill_rect(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_fill_rect((int)(i * 37u) % 96, (int)(i * 13u) % 48, 32, 16, i & 1);
+}
+
+static void b_gfx_text5x7(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_text5x7((int)(i * 5u) & 63, (int)(i * 13u) % 56, "SCORE 1234", i & 1);
+}
+
+static void b_gfx_sprite_rows(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_sprite_rows((int)(i * 37u) % 120, (int)(i * 13u) % 56, 8, 8, (const char**)s_sprite);
+}
+
+static void b_gfx_blit(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        gfx_blit((int)(i * 37u) % 120, (int)(i * 13u) % 56, &s_spr, GFX_BLIT_XOR);
+}
+
+static void b_ssd1306_char(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        ssd1306_char(&disp, (int)(i * 37u) % 122, (int)(i * 13u) % 56, (char)('0' + i % 43), i & 1);
+}
+
+static void b_ssd1306_string(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        ssd1306_string(&disp, (int)(i * 5u) & 63, (int)(i * 13u) % 56, "SCORE 1234", i & 1);
+}
+
+static void b_animation_a_render(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) animation_a_render((uint8_t)i);
+}
+
+// Decode into the framebuffer in sequence, as the clip player does
+static anim_stream_t s_clip_b;
+
+static bool has_animation_b(void) { return asset_clip("animation_b", &s_clip_b); }
+
+static void b_animation_b_blit(uint32_t n) {
+    for (uint32_t i = 0; i < n; i++)
+        anim_decode_frame(&s_clip_b, (uint16_t)(i % s_clip_b.frame_count), disp.buf);
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(uint32_t n);
+    bool (*ready)(void);        // False skips the case (its asset is missing); NULL = always
+} bench_case_t;
+
+static const bench_case_t s_cases[] = {
+    { "gfx_plot",           b_gfx_plot,             NULL },
+    { "gfx_hline",          b_gfx_hline,            NULL },
+    { "gfx_fill_rect",      b_gfx_fill_rect,        NULL },
+    { "gfx_text5x7",        b_gfx_text5x7,          NULL },
+    { "gfx_sprite_rows",    b_gfx_sprite_rows,      NULL },
+    { "gfx_blit",           b_gfx_blit,             NULL },
+    { "ssd1306_char",       b_ssd1306_char,         NULL },
+    { "ssd1306_string",     b_ssd1306_string,       NULL },
+    { "animation_a_render", b_animation_a_render,   NULL },
+    { "animation_b_blit",   b_animation_b_blit,     has_animation_b },
+};
+
+#define CASE_COUNT (int)(sizeof(s_cases) / sizeof(s_cases[0]))
+
+// ---- Runner -----------------------------------------------------------------
+
+static bool time_batch(const bench_clock_t* clk, const bench_case_t* c, uint32_t n, bench_sample_t* out) {
+    clk->start();
+    c->run(n);
+    return clk->stop(out);
+}
+
+// Double the batch until it takes a quarter of the target, then scale it
+// to the target
+static uint32_t calibrate(const bench_clock_t* clk, const bench_case_t* c, uint32_t target_us) {
+    uint64_t target_ns = (uint64_t)target_us * 1000u;
+    uint32_t n = 1;
+    bench_sample_t s;
+    while (true) {
+        time_batch(clk, c, n, &s);
+        if (s.ns >= target_ns / 4 || n >= (1u << 30)) break;
+        n <<= 1;
+    }
+    if (!s.ns) return n;
+    uint64_t scaled = (uint64_t)n * target_ns / s.ns;
+    if (scaled < 1) scaled = 1;
+    if (scaled > (1u << 30)) scaled = 1u << 30;
+    return (uint32_t)scaled;
+}
+
+void bench_list(FILE* out) {
+    for (int i = 0; i < CASE_COUNT; i++) fprintf(out, "%s\n", s_cases[i].name);
+}
+
+int bench_run(const bench_clock_t* clk, const char* filter, uint32_t target_us, FILE* out) {
+    gfx_sprite_pack(&s_spr, s_spr_bits, NULL, 8, 8, (const char**)s_sprite);
+    fprintf(out, "platform,bench,ops,ns_per_op,cycles_per_op\n");
+
+    int ran = 0;
+    for (int i = 0; i < CASE_COUNT; i++) {
+        const bench_case_t* c = &s_cases[i];
+        if (filter && !strstr(c->name, filter)) continue;
+        if (c->ready && !c->ready()) {
+            fprintf(stderr, "bench: skipping %s\n", c->name);
+            continue;
+        }
+
+        gfx_clear();
+        uint32_t n = calibrate(clk, c, target_us);
+        bench_sample_t best = { 0, 0 };
+        bool cycles = true;
+        for (int r = 0; r < BENCH_REPS; r++) {
+            bench_sample_t s;
+            cycles &= time_batch(clk, c, n, &s);
+            if (r == 0 || s.ns < best.ns) best = s;
+        }
+
+        fprintf(out, "%s,%s,%lu,%.2f,", clk->platform, c->name, (unsigned long)n,
+                (double)best.ns / n);
+        if (cycles) fprintf(out, "%.1f", (double)best.cycles / n);
+        fprintf(out, "\n");
+        fflush(out);
+        ran++;
+    }
+    gfx_clear();
+    return ran;
+}
+
+// ---- Device -----------------------------------------------------------------
+// The M0+ has no DWT cycle counter, so cycles come from SysTick running
+// on the processor clock: 24 bits, about 134 ms at 125 MHz. Batches
+// longer than that fall back to timer microseconds times clk_sys.
+
+#if !PICOF_HOST
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "input/input.h"
+#include "registry/registry.h"
+
+#define SYSTICK_MAX 0x00FFFFFFu
+
+static uint64_t s_t0_us;
+static uint32_t s_t0_tick;
+
+static void device_start(void) {
+    systick_hw->rvr = SYSTICK_MAX;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;      // ENABLE | CLKSOURCE = processor clock
+    s_t0_us = time_us_64();
+    s_t0_tick = systick_hw->cvr;
+}
+
+static bool device_stop(bench_sample_t* out) {
+    uint32_t tick = systick_hw->cvr;
+    uint64_t us = time_us_64() - s_t0_us;
+    uint64_t hz = clock_get_hz(clk_sys);
+    out->ns = us * 1000u;
+    if (us * hz / 1000000u < SYSTICK_MAX / 2)
+        out->cycles = (s_t0_tick - tick) & SYSTICK_MAX;  // Counts down
+    else
+        out->cycles = us * hz / 1000000u;
+    return true;
+}
+
+static const bench_clock_t s_device_clock = { "rp2040", device_start, device_stop };
+
+void run_bench(void) {
+    gfx_clear();
+    gfx_text5x7(0, 0, "Benchmarking...", true);
+    gfx_show();
+    ssd1306_wait_present(&disp);
+
+    int ran = bench_run(&s_device_clock, NULL, 20000, stdout);
+
+    gfx_clear();
+    gfx_text5x7(0, 0, "Benchmark done", true);
+    char line[24];
+    snprintf(line, sizeof(line), "%d cases, CSV", ran);
+    gfx_text5x7(0, 9, line, true);
+    gfx_text5x7(0, 18, "on USB serial", true);
+    gfx_show();
+
+    while (true) {
+        input_update(to_ms_since_boot(get_absolute_time()));
+        if (exit_combo_triggered()) return;
+        sleep_ms(20);
+    }
+}
+
+REGISTER_PROGRAM(bench, "Benchmark", NULL);
+#endif
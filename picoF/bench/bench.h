@@ -0,0 +1,43 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Micro-benchmarks for the drawing primitives and the animation inner
+// loops. Each case is timed in batches sized to about target_us; the
+// fastest of BENCH_REPS batches is reported, one CSV row per case:
+//   platform,bench,ops,ns_per_op,cycles_per_op
+// cycles_per_op is empty when the clock has no cycle counter.
+//
+// On the device the suite is the "Benchmark" program (timer + SysTick,
+// CSV over stdio); on the host it is picoF_bench (host/bench_main.c).
+
+// Timed batches per case, after calibration
+#ifndef BENCH_REPS
+#define BENCH_REPS 5
+#endif
+
+typedef struct {
+    uint64_t ns;
+    uint64_t cycles;
+} bench_sample_t;
+
+// Time source for one batch. stop() returns false for cycles when there
+// is no cycle count for the batch.
+typedef struct {
+    const char* platform;
+    void (*start)(void);
+    bool (*stop)(bench_sample_t* out);
+} bench_clock_t;
+
+// Run every case whose name contains filter (NULL runs all), writing the
+// header and one row per case to out. Draws into the gfx target, so the
+// caller restores the screen afterwards. Returns the number of cases run.
+int bench_run(const bench_clock_t* clk, const char* filter, uint32_t target_us, FILE* out);
+
+// Print the case names, one per line
+void bench_list(FILE* out);
+
+#endif // BENCH_H
@@ -32,7 +32,6 @@ static int ball_x, ball_y;
 static int ball_dx, ball_dy;
 static int score;
 static int level;
-static bool running;
 
 static void draw_paddle(void) {
     ssd1306_fill_rect(paddle_x, SCREEN_H - 6, PADDLE_W, PADDLE_H, 1);
@@ -75,61 +74,11 @@ static void draw_center_text(const char *text, int y) {
     ssd1306_draw_string((SCREEN_W - w) / 2, y, text, 1, 0);
 }
 
-static void wait_for_button(void) {
-    for (;;) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        input_update(now);
-
-        // Any Brickout-relevant press dismisses: Left, Middle(Launch), Right
-        if (action_pressed(ACTION_PADDLE_LEFT) ||
-            action_pressed(ACTION_LAUNCH) ||
-            action_pressed(ACTION_PADDLE_RIGHT)) {
-            break;
-        }
-        // Optional: universal exit combo can skip this screen too
-        if (exit_combo_triggered()) break;
-
-        sleep_ms(50);
-    }
-    sleep_ms(200);
-}
-
-static void show_level_screen(void) {
-    ssd1306_clear();
-    char buf[16];
-    sprintf(buf, "LEVEL %d", level);
-    draw_center_text(buf, 28);
-    ssd1306_show();
-    wait_for_button();
-}
-
-static void show_game_over(bool final_level) {
-    ssd1306_clear();
-    if (final_level) {
-        absolute_time_t end_time = make_timeout_time_ms(3000);
-        while (!time_reached(end_time)) {
-            uint32_t now = to_ms_since_boot(get_absolute_time());
-            input_update(now);
-            if (exit_combo_triggered()) break;
-
-            ssd1306_clear();
-            for (int i = 0; i < 20; i++) {
-                int x = rand() % SCREEN_W;
-                int y = rand() % SCREEN_H;
-                ssd1306_draw_pixel(x, y, 1);
-            }
-            draw_center_text("YOU WIN!", 28);
-            ssd1306_show();
-            sleep_ms(200);
-        }
-    } else {
-        draw_center_text("GAME OVER", 24);
-        char buf[16];
-        sprintf(buf, "SCORE: %d", score);
-        draw_center_text(buf, 36);
-        ssd1306_show();
-        wait_for_button();
-    }
+// Any Brickout-relevant press: Left, Middle(Launch), Right
+static bool any_pressed(void) {
+    return action_pressed(ACTION_PADDLE_LEFT) ||
+           action_pressed(ACTION_LAUNCH) ||
+           action_pressed(ACTION_PADDLE_RIGHT);
 }
 
 static void update_ball(void) {
@@ -181,60 +130,120 @@ static void handle_input(void) {
     if (action_held(ACTION_PADDLE_RIGHT) && paddle_x < SCREEN_W - PADDLE_W) {
         paddle_x += 2;
     }
-    if (exit_combo_triggered()) {
-        running = false; // universal exit to menu (Left+Right hold)
-    }
 }
 
-static void game_loop(void) {
-    running = true;
-    score = 0;
-    level = 1;
+// ---- Lifecycle ----
+// The launcher steps the game every STEP_MS; the ball moves every
+// ball_steps() of those, so it speeds up with the level (20, 15, 10 ms).
+#define STEP_MS     5
+#define WIN_MS      3000
+#define SPARKLE_MS  200
 
-    while (running && level <= MAX_LEVEL) {
-        init_bricks();
-        reset_ball_paddle();
-        show_level_screen();
+typedef enum { ST_TITLE, ST_LEVEL, ST_PLAY, ST_WIN, ST_GAME_OVER } State;
 
-        while (running) {
-            uint32_t now = to_ms_since_boot(get_absolute_time());
-            input_update(now);
+static State state;
+static uint32_t state_steps;
+static bool redraw;
 
-            handle_input();
-            update_ball();
+static int ball_steps(void) {
+    return (10 + (MAX_LEVEL - level) * 5) / STEP_MS;
+}
 
-            if (ball_y > SCREEN_H) {
-                running = false;
-                break;
-            }
+static void enter(State s) {
+    state = s;
+    state_steps = 0;
+    redraw = true;
+}
 
-            if (!bricks_remaining()) {
-                level++;
-                break;
-            }
+static void start_level(void) {
+    init_bricks();
+    reset_ball_paddle();
+    enter(ST_LEVEL);
+}
+
+static void brickout_init(void) {
+    score = 0;
+    level = 1;
+    enter(ST_TITLE);
+}
 
-            ssd1306_clear();
-            draw_paddle();
-            draw_ball();
-            draw_bricks();
-            ssd1306_show();
-            sleep_ms(10 + (MAX_LEVEL - level) * 5); // speed up with level
+static void brickout_resume(void) {
+    redraw = true;
+}
+
+static bool brickout_update(void) {
+    state_steps++;
+    switch (state) {
+    case ST_TITLE:
+        if (any_pressed()) start_level();
+        break;
+    case ST_LEVEL:
+        if (any_pressed()) enter(ST_PLAY);
+        break;
+    case ST_PLAY:
+        if (state_steps % ball_steps()) break;
+        handle_input();
+        update_ball();
+        redraw = true;
+        if (ball_y > SCREEN_H) {
+            enter(ST_GAME_OVER);
+        } else if (!bricks_remaining()) {
+            if (++level > MAX_LEVEL) enter(ST_WIN);
+            else start_level();
         }
+        break;
+    case ST_WIN:
+        if (state_steps * STEP_MS >= WIN_MS) return false;
+        if (state_steps % (SPARKLE_MS / STEP_MS) == 0) redraw = true;
+        break;
+    case ST_GAME_OVER:
+        if (any_pressed()) return false;
+        break;
     }
-
-    show_game_over(level > MAX_LEVEL);
+    return true;
 }
 
-void run_brickout(void) {
-    ssd1306_init(&disp, I2C_PORT, 0x3C, SCREEN_W, SCREEN_H);
+static void brickout_render(uint8_t alpha) {
+    (void)alpha;
+    if (!redraw) return;
+    redraw = false;
 
+    char buf[16];
     ssd1306_clear();
-    draw_center_text("BRICK-OUT", 24);
+    switch (state) {
+    case ST_TITLE:
+        draw_center_text("BRICK-OUT", 24);
+        break;
+    case ST_LEVEL:
+        sprintf(buf, "LEVEL %d", level);
+        draw_center_text(buf, 28);
+        break;
+    case ST_PLAY:
+        draw_paddle();
+        draw_ball();
+        draw_bricks();
+        break;
+    case ST_WIN:
+        for (int i = 0; i < 20; i++) {
+            int x = rand() % SCREEN_W;
+            int y = rand() % SCREEN_H;
+            ssd1306_draw_pixel(x, y, 1);
+        }
+        draw_center_text("YOU WIN!", 28);
+        break;
+    case ST_GAME_OVER:
+        draw_center_text("GAME OVER", 24);
+        sprintf(buf, "SCORE: %d", score);
+        draw_center_text(buf, 36);
+        break;
+    }
     ssd1306_show();
-    wait_for_button();
-
-    game_loop();
 }
 
-// Keep your existing registry macro style
-REGISTER_PROGRAM(brickout, "Brick-Out", NULL);
+REGISTER_PROGRAM_OPS(brickout, "Brick-Out", NULL,
+    .step_us = STEP_MS * 1000,
+    .input = PROGRAM_BRICKOUT,
+    .init = brickout_init,
+    .update = brickout_update,
+    .render = brickout_render,
+    .resume = brickout_resume);
@@ -0,0 +1,98 @@
+#include "busprof.h"
+
+#if BUS_PROFILE
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "present.h"
+
+typedef struct {
+    uint32_t since_us;
+    uint32_t frames;
+    uint32_t transactions, bytes, bus_us;
+    uint32_t frame_us_max, frame_bytes_max;
+    uint32_t nacks, timeouts;
+} span_t;
+
+static const char* s_program;
+static ssd1306_bus_stats_t s_last;
+static span_t s_period, s_total;
+
+static void span_reset(span_t* s, uint32_t now) {
+    memset(s, 0, sizeof(*s));
+    s->since_us = now;
+}
+
+static void span_add(span_t* s, const ssd1306_bus_stats_t* d, bool frame) {
+    s->frames += frame;
+    s->transactions += d->transactions;
+    s->bytes += d->bytes;
+    s->bus_us += d->bus_us;
+    s->nacks += d->nacks;
+    s->timeouts += d->timeouts;
+    if (d->bus_us > s->frame_us_max) s->frame_us_max = d->bus_us;
+    if (d->bytes > s->frame_bytes_max) s->frame_bytes_max = d->bytes;
+}
+
+static void span_print(const span_t* s) {
+    printf("%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+           (unsigned long)s->frames, (unsigned long)s->transactions,
+           (unsigned long)s->bytes, (unsigned long)s->bus_us,
+           (unsigned long)s->frame_us_max, (unsigned long)s->frame_bytes_max,
+           (unsigned long)s->nacks, (unsigned long)s->timeouts);
+}
+
+// Charge everything since the last boundary, as a frame or (when the
+// program changes) as the tail of the last one
+static void take_traffic(bool frame) {
+    ssd1306_bus_stats_t cur, d;
+    present_get_bus_stats(&cur);
+    d.transactions = cur.transactions - s_last.transactions;
+    d.bytes = cur.bytes - s_last.bytes;
+    d.bus_us = cur.bus_us - s_last.bus_us;
+    d.nacks = cur.nacks - s_last.nacks;
+    d.timeouts = cur.timeouts - s_last.timeouts;
+    s_last = cur;
+
+    span_add(&s_period, &d, frame);
+    span_add(&s_total, &d, frame);
+}
+
+static void flush_period(uint32_t now) {
+    if (s_period.frames) {
+        printf("bus,%lu,%s,", (unsigned long)to_ms_since_boot(get_absolute_time()), s_program);
+        span_print(&s_period);
+    }
+    span_reset(&s_period, now);
+}
+
+static void on_frame(void* user) {
+    (void)user;
+    uint32_t now = time_us_32();
+    take_traffic(true);
+    if (now - s_period.since_us >= BUS_PROFILE_PERIOD_MS * 1000u) flush_period(now);
+}
+
+void busprof_init(ssd1306_t* s) {
+    uint32_t now = time_us_32();
+    present_get_bus_stats(&s_last);
+    s_program = "menu";
+    span_reset(&s_period, now);
+    span_reset(&s_total, now);
+    ssd1306_set_frame_hook(s, on_frame, NULL);
+}
+
+void busprof_program(const char* name) {
+    uint32_t now = time_us_32();
+    take_traffic(false);
+    flush_period(now);
+    if (s_total.frames) {
+        printf("bus_program,%lu,%s,%lu,", (unsigned long)to_ms_since_boot(get_absolute_time()), s_program,
+               (unsigned long)((now - s_total.since_us) / 1000));
+        span_print(&s_total);
+    }
+    span_reset(&s_total, now);
+    s_program = name;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef BUSPROF_H
+#define BUSPROF_H
+
+#include "ssd1306.h"
+#include "hardware_config.h"
+
+// Display bus profiler. Each present on the display closes a frame: the
+// bus traffic counted by the transport since the previous present (see
+// ssd1306_bus_stats_t) is charged to it. With async presents a frame's
+// own traffic is still on the bus at that point, so the charge lags by up
+// to one frame.
+//
+// Lines go to stdio (USB CDC), prefixed so they can be picked out of
+// other output; tools/busprof/busprof.py decodes them.
+//
+// Every BUS_PROFILE_PERIOD_MS, if frames were presented:
+//   bus,t_ms,program,frames,transactions,bytes,bus_us,frame_us_max,frame_bytes_max,nacks,timeouts
+// When a program hands the bus on, its totals:
+//   bus_program,t_ms,program,elapsed_ms,frames,transactions,bytes,bus_us,frame_us_max,frame_bytes_max,nacks,timeouts
+
+#if BUS_PROFILE
+
+// Hook s's presents and start charging frames to "menu"
+void busprof_init(ssd1306_t* s);
+
+// Report the current program's totals and charge what follows to name
+void busprof_program(const char* name);
+
+#else
+
+static inline void busprof_init(ssd1306_t* s) { (void)s; }
+static inline void busprof_program(const char* name) { (void)name; }
+
+#endif
+
+#endif // BUSPROF_H
@@ -0,0 +1,127 @@
+# Shared by the firmware build (../CMakeLists.txt) and the host build
+# (../host/CMakeLists.txt): source lists, include folders and the clip
+# helper. New modules and programs go here so both builds pick them up.
+
+set(PICOF_DIR ${CMAKE_CURRENT_LIST_DIR}/..)
+
+set(PICOF_MODULE_SOURCES
+    ${PICOF_DIR}/anim/anim_codec.c
+    ${PICOF_DIR}/anim/anim_player.c
+    ${PICOF_DIR}/assets/assets.c
+    ${PICOF_DIR}/busprof/busprof.c
+    ${PICOF_DIR}/hardware/hardware_init.c
+    ${PICOF_DIR}/font/font.c
+    ${PICOF_DIR}/gameloop/gameloop.c
+    ${PICOF_DIR}/gfx/gfx.c
+    ${PICOF_DIR}/input/input.c
+    ${PICOF_DIR}/perf/perf.c
+    ${PICOF_DIR}/present/present.c
+    ${PICOF_DIR}/prof/prof.c
+    ${PICOF_DIR}/registry/registry.c
+    ${PICOF_DIR}/ssd1306/ssd1306.c
+    ${PICOF_DIR}/ssd1306/ssd1306_i2c.c
+    ${PICOF_DIR}/ssd1306/ssd1306_mem.c
+    ${PICOF_DIR}/ssd1306/ssd1306_spi.c
+)
+
+set(PICOF_PROGRAM_SOURCES
+    ${PICOF_DIR}/animationA/animation_a.c
+    ${PICOF_DIR}/animationB/animation_b.c
+    ${PICOF_DIR}/animationC/animation_c.c
+    ${PICOF_DIR}/dino/dino.c
+    ${PICOF_DIR}/brickout/brickout.c
+    ${PICOF_DIR}/bench/bench.c
+)
+
+# Only shared module folders + project root.
+# Program folders are NOT added, so includes must be prefixed (e.g., "animationB/animation_b.h")
+set(PICOF_INCLUDE_DIRS
+    ${PICOF_DIR}
+    ${PICOF_DIR}/anim
+    ${PICOF_DIR}/assets
+    ${PICOF_DIR}/busprof
+    ${PICOF_DIR}/hardware
+    ${PICOF_DIR}/font
+    ${PICOF_DIR}/gameloop
+    ${PICOF_DIR}/gfx
+    ${PICOF_DIR}/input
+    ${PICOF_DIR}/perf
+    ${PICOF_DIR}/present
+    ${PICOF_DIR}/prof
+    ${PICOF_DIR}/registry
+    ${PICOF_DIR}/ssd1306
+)
+
+# picoF_add_clip(<target> <name> <frame dir> [MS <default ms>])
+# Compiles <frame dir>/*.pbm|*.pgm (sorted by name) into <name>_anim with
+# the asset compiler at ${ASSETC} (built by ${ASSETC_DEPENDS}).
+# An optional <frame dir>/timing.txt sets per-frame durations. Only for a
+# clip that has to be in the firmware image; others go in the asset pack.
+function(picoF_add_clip target name dir)
+    cmake_parse_arguments(CLIP "" "MS" "" ${ARGN})
+    if(NOT CLIP_MS)
+        set(CLIP_MS 100)
+    endif()
+    file(GLOB frames CONFIGURE_DEPENDS ${dir}/*.pbm ${dir}/*.pgm)
+    list(SORT frames)
+    set(args clip --name ${name} --ms ${CLIP_MS})
+    set(deps ${frames})
+    if(EXISTS ${dir}/timing.txt)
+        list(APPEND args --timing ${dir}/timing.txt)
+        list(APPEND deps ${dir}/timing.txt)
+    endif()
+    set(out ${CMAKE_BINARY_DIR}/assets/${name}_anim.c)
+    add_custom_command(
+        OUTPUT ${out}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_BINARY_DIR}/assets
+        COMMAND ${ASSETC} ${args} --out ${out} ${frames}
+        DEPENDS ${ASSETC_DEPENDS} ${deps}
+        COMMENT "assetc: ${name}"
+        VERBATIM
+    )
+    target_sources(${target} PRIVATE ${out})
+endfunction()
+
+# Flash asset pack (assets/assets.h). Entries are assetc pack arguments:
+#   clip:<name>=<frame dir>     *.pbm|*.pgm frames, optional timing.txt
+#   bitmap:<name>=<image>       one PBM/PGM
+#   raw:<name>=<file>
+# A clip becomes a launcher program with one REGISTER_CLIP line
+# (anim/anim_player.h) in any program source.
+set(PICOF_ASSETS
+    clip:animation_b=${PICOF_DIR}/animationB/frames
+    clip:animation_c=${PICOF_DIR}/animationC/frames
+)
+
+# Flash offset of the pack; ASSET_PACK_OFFSET in the firmware
+set(PICOF_ASSET_PACK_OFFSET 0x100000 CACHE STRING "Asset pack offset in flash")
+set(PICOF_ASSET_PACK ${CMAKE_BINARY_DIR}/assets/assets.bin)
+
+# picoF_add_asset_pack(<target>)
+# Custom target building ${PICOF_ASSET_PACK} and assets.uf2 next to it,
+# which writes only the pack's flash region. The firmware doesn't depend on
+# it, so changing an asset neither recompiles nor reflashes code.
+function(picoF_add_asset_pack target)
+    set(deps)
+    foreach(asset ${PICOF_ASSETS})
+        string(REGEX REPLACE "^[^=]*=" "" path ${asset})
+        if(IS_DIRECTORY ${path})
+            file(GLOB files CONFIGURE_DEPENDS ${path}/*.pbm ${path}/*.pgm ${path}/timing.txt)
+            list(APPEND deps ${files})
+        else()
+            list(APPEND deps ${path})
+        endif()
+    endforeach()
+    get_filename_component(dir ${PICOF_ASSET_PACK} DIRECTORY)
+    set(uf2 ${dir}/assets.uf2)
+    add_custom_command(
+        OUTPUT ${PICOF_ASSET_PACK} ${uf2}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${dir}
+        COMMAND ${ASSETC} pack --out ${PICOF_ASSET_PACK} --uf2 ${uf2}
+                --offset ${PICOF_ASSET_PACK_OFFSET} ${PICOF_ASSETS}
+        DEPENDS ${ASSETC_DEPENDS} ${deps}
+        COMMENT "assetc: asset pack"
+        VERBATIM
+    )
+    add_custom_target(${target} ALL DEPENDS ${PICOF_ASSET_PACK} ${uf2})
+endfunction()
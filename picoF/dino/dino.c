@@ -9,14 +9,14 @@
 #include "gfx.h"
 #include "registry.h"
 #include "hardware_init.h"
+#include "present.h"
+#include "perf.h"
 #include "input/input.h"
 
-REGISTER_PROGRAM(dino, "Dino", NULL);
-
 // ===== Display =====
 #define OLED_W 128
 #define OLED_H  64
-#define FRAME_MS        33    // ~30 FPS
+#define FRAME_MS        33    // Simulation step, ~30 FPS
 #define GROUND_Y        54
 #define DINO_X          14
 #define GRAVITY          1.2
@@ -162,6 +162,30 @@ static const char* BIRD_B_16x8[8] = {
 "................"
 };
 
+// ===== Packed sprites (built once from the art above) =====
+static gfx_sprite_t SPR_RUN_A, SPR_RUN_B, SPR_DUCK_A, SPR_DUCK_B;
+static gfx_sprite_t SPR_CACTUS_S, SPR_CACTUS_L, SPR_BIRD_A, SPR_BIRD_B;
+static uint8_t sprite_pool[2 * GFX_SPRITE_BYTES(16, 16) + 2 * GFX_SPRITE_BYTES(22, 12)
+                         + GFX_SPRITE_BYTES(8, 16) + GFX_SPRITE_BYTES(12, 18)
+                         + 2 * GFX_SPRITE_BYTES(16, 8)];
+
+static void pack_sprites(void) {
+    static bool packed = false;
+    if (packed) return;
+    uint8_t* p = sprite_pool;
+#define PACK(spr, rows, w, h) gfx_sprite_pack(&spr, p, NULL, w, h, rows); p += GFX_SPRITE_BYTES(w, h)
+    PACK(SPR_RUN_A, DINO_RUN_A, 16, 16);
+    PACK(SPR_RUN_B, DINO_RUN_B, 16, 16);
+    PACK(SPR_DUCK_A, DINO_DUCK_A, 22, 12);
+    PACK(SPR_DUCK_B, DINO_DUCK_B, 22, 12);
+    PACK(SPR_CACTUS_S, CACTUS_S_8x16, 8, 16);
+    PACK(SPR_CACTUS_L, CACTUS_L_12x18, 12, 18);
+    PACK(SPR_BIRD_A, BIRD_A_16x8, 16, 8);
+    PACK(SPR_BIRD_B, BIRD_B_16x8, 16, 8);
+#undef PACK
+    packed = true;
+}
+
 // ===== Obstacles =====
 typedef enum { OBS_CACTUS_S, OBS_CACTUS_L, OBS_BIRD } obs_type_t;
 typedef struct {
@@ -191,23 +215,23 @@ static void draw_clouds(uint32_t t) {
 static void draw_dino(uint32_t t_ms) {
     bool alt = ((t_ms / ANIM_MS) % 2) == 0;
     if (!jumping && ducking) {
-        gfx_sprite_rows(DINO_X, dino_y - DINO_DUCK_H, DINO_DUCK_W, DINO_DUCK_H, alt ? DINO_DUCK_A : DINO_DUCK_B);
+        gfx_blit(DINO_X, dino_y - DINO_DUCK_H, alt ? &SPR_DUCK_A : &SPR_DUCK_B, GFX_BLIT_OR);
     } else {
-        gfx_sprite_rows(DINO_X, dino_y - 16, 16, 16, alt ? DINO_RUN_A : DINO_RUN_B);
+        gfx_blit(DINO_X, dino_y - 16, alt ? &SPR_RUN_A : &SPR_RUN_B, GFX_BLIT_OR);
     }
 }
 static void draw_obstacle(const obstacle_t* o, uint32_t t_ms) {
     if (!o->active) return;
     switch (o->type) {
         case OBS_CACTUS_S:
-            gfx_sprite_rows(o->x, GROUND_Y - 16, 8, 16, CACTUS_S_8x16);
+            gfx_blit(o->x, GROUND_Y - 16, &SPR_CACTUS_S, GFX_BLIT_OR);
             break;
         case OBS_CACTUS_L:
-            gfx_sprite_rows(o->x, GROUND_Y - CACTUS_L_H, CACTUS_L_W, CACTUS_L_H, CACTUS_L_12x18);
+            gfx_blit(o->x, GROUND_Y - CACTUS_L_H, &SPR_CACTUS_L, GFX_BLIT_OR);
             break;
         case OBS_BIRD: {
             bool wing = ((t_ms/120)%2)==0;
-            gfx_sprite_rows(o->x, o->y - 8, 16, 8, wing ? BIRD_A_16x8 : BIRD_B_16x8);
+            gfx_blit(o->x, o->y - 8, wing ? &SPR_BIRD_A : &SPR_BIRD_B, GFX_BLIT_OR);
             } break;
     }
 }
@@ -284,84 +308,97 @@ static void reset_game(void) {
     for (int i = 0; i < MAX_OBS; i++) obs[i].active = false;
 }
 
-void run_dino(void) {
-    hardware_init();
-    gfx_init(&disp);
-
-    reset_game();
-
-    uint32_t t_ms = 0;
-    uint32_t anim_t = 0;
+static uint32_t t_ms;
+static uint32_t anim_t;
 
-    while (true) {
-        sleep_ms(FRAME_MS);
-        t_ms += FRAME_MS;
-        anim_t += FRAME_MS;
+// One FRAME_MS step of the game. The launcher has already sampled input and
+// suspends the game on the exit combo (Left+Right hold).
+static bool dino_update(void) {
+    t_ms += FRAME_MS;
+    anim_t += FRAME_MS;
 
-        // New input layer timing + universal exit combo
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        input_update(now);
-        if (exit_combo_triggered()) {
-            return; // Left+Right hold → back to menu
+    if (!game_over) {
+        // Right button = Jump (edge)
+        if (action_pressed(ACTION_JUMP) && !jumping) {
+            jumping = true;
+            vel_y = JUMP_VEL;
+            ducking = false;
         }
+        // Left button = Duck (hold)
+        ducking = action_held(ACTION_DUCK) && !jumping;
 
-        if (!game_over) {
-            // Right button = Jump (edge)
-            if (action_pressed(ACTION_JUMP) && !jumping) {
-                jumping = true;
-                vel_y = JUMP_VEL;
-                ducking = false;
+        if (jumping) {
+            dino_y += vel_y;
+            vel_y += GRAVITY;
+            if (dino_y >= GROUND_Y) {
+                dino_y = GROUND_Y;
+                vel_y = 0;
+                jumping = false;
             }
-            // Left button = Duck (hold)
-            ducking = action_held(ACTION_DUCK) && !jumping;
+        }
+
+        update_obstacles();
 
-            if (jumping) {
-                dino_y += vel_y;
-                vel_y += GRAVITY;
-                if (dino_y >= GROUND_Y) {
-                    dino_y = GROUND_Y;
-                    vel_y = 0;
-                    jumping = false;
-                }
+        for (int i = 0; i < MAX_OBS; i++) {
+            if (obs[i].active && dino_hit(&obs[i])) {
+                game_over = true;
+                if (score > hi_score) hi_score = score;
+                break;
             }
+        }
 
-            update_obstacles();
+        score++;
+        if ((score % 150) == 0 && speed_x < MAX_SPEED_X) speed_x++;
+        perf_note((uint16_t)speed_x);   // Frame timings by speed, see perf_dump()
+    } else if (action_held(ACTION_RESTART)) {
+        // Middle button = Restart (hold)
+        reset_game();
+    }
+    return true;
+}
 
-            for (int i = 0; i < MAX_OBS; i++) {
-                if (obs[i].active && dino_hit(&obs[i])) {
-                    game_over = true;
-                    if (score > hi_score) hi_score = score;
-                    break;
-                }
-            }
+static void dino_render(uint8_t alpha) {
+    (void)alpha;
+    gfx_clear();
+    if (!game_over) {
+        draw_clouds(t_ms);
+        draw_ground();
+        draw_dino(anim_t);
+        for (int i = 0; i < MAX_OBS; i++) draw_obstacle(&obs[i], anim_t);
+        draw_scores();
+    } else {
+        // Game over screen
+        draw_ground();
+        draw_dino(anim_t);
+        for (int i = 0; i < MAX_OBS; i++) draw_obstacle(&obs[i], anim_t);
+        draw_scores();
+        gfx_text5x7(37, 22, "GAME OVER", true);
+        gfx_text5x7(25, 38, "PRESS RESTART", true);
+    }
+    gfx_show();
+}
 
-            score++;
-            if ((score % 150) == 0 && speed_x < MAX_SPEED_X) speed_x++;
+static void dino_init(void) {
+    pack_sprites();
+    reset_game();
+    t_ms = 0;
+    anim_t = 0;
+    present_reset_stats();
+}
 
-            // Render
-            gfx_clear();
-            draw_clouds(t_ms);
-            draw_ground();
-            draw_dino(anim_t);
-            for (int i = 0; i < MAX_OBS; i++) draw_obstacle(&obs[i], anim_t);
-            draw_scores();
-            gfx_show();
-        } else {
-            // Game over screen
-            gfx_clear();
-            draw_ground();
-            draw_dino(anim_t);
-            for (int i = 0; i < MAX_OBS; i++) draw_obstacle(&obs[i], anim_t);
-            draw_scores();
-            gfx_text5x7(37, 22, "GAME OVER", true);
-            gfx_text5x7(25, 38, "PRESS RESTART", true);
-            gfx_show();
+static void dino_resume(void) {
+    present_reset_stats();
+}
 
-            // Middle button = Restart (hold)
-            if (action_held(ACTION_RESTART)) {
-                reset_game();
-                sleep_ms(150);
-            }
-        }
-    }
+static void dino_suspend(void) {
+    present_report("dino");
 }
+
+REGISTER_PROGRAM_OPS(dino, "Dino", NULL,
+    .step_us = FRAME_MS * 1000,
+    .input = PROGRAM_DINO,
+    .init = dino_init,
+    .update = dino_update,
+    .render = dino_render,
+    .suspend = dino_suspend,
+    .resume = dino_resume);
@@ -0,0 +1,196 @@
+#include "font.h"
+#include <string.h>
+
+// Standard ASCII 5x7 font table (0x20-0x7E)
+static const uint8_t font5x7_bitmap[][5] = {
+    {0x00,0x00,0x00,0x00,0x00}, // 0x20 ' '
+    {0x00,0x00,0x5F,0x00,0x00}, // 0x21 '!'
+    {0x00,0x07,0x00,0x07,0x00}, // 0x22 '"'
+    {0x14,0x7F,0x14,0x7F,0x14}, // 0x23 '#'
+    {0x24,0x2A,0x7F,0x2A,0x12}, // 0x24 '$'
+    {0x23,0x13,0x08,0x64,0x62}, // 0x25 '%'
+    {0x36,0x49,0x55,0x22,0x50}, // 0x26 '&'
+    {0x00,0x05,0x03,0x00,0x00}, // 0x27 '\''
+    {0x00,0x1C,0x22,0x41,0x00}, // 0x28 '('
+    {0x00,0x41,0x22,0x1C,0x00}, // 0x29 ')'
+    {0x14,0x08,0x3E,0x08,0x14}, // 0x2A '*'
+    {0x08,0x08,0x3E,0x08,0x08}, // 0x2B '+'
+    {0x00,0x50,0x30,0x00,0x00}, // 0x2C ','
+    {0x08,0x08,0x08,0x08,0x08}, // 0x2D '-'
+    {0x00,0x60,0x60,0x00,0x00}, // 0x2E '.'
+    {0x20,0x10,0x08,0x04,0x02}, // 0x2F '/'
+    {0x3E,0x51,0x49,0x45,0x3E}, // 0x30 '0'
+    {0x00,0x42,0x7F,0x40,0x00}, // 0x31 '1'
+    {0x42,0x61,0x51,0x49,0x46}, // 0x32 '2'
+    {0x21,0x41,0x45,0x4B,0x31}, // 0x33 '3'
+    {0x18,0x14,0x12,0x7F,0x10}, // 0x34 '4'
+    {0x27,0x45,0x45,0x45,0x39}, // 0x35 '5'
+    {0x3C,0x4A,0x49,0x49,0x30}, // 0x36 '6'
+    {0x01,0x71,0x09,0x05,0x03}, // 0x37 '7'
+    {0x36,0x49,0x49,0x49,0x36}, // 0x38 '8'
+    {0x06,0x49,0x49,0x29,0x1E}, // 0x39 '9'
+    {0x00,0x36,0x36,0x00,0x00}, // 0x3A ':'
+    {0x00,0x56,0x36,0x00,0x00}, // 0x3B ';'
+    {0x08,0x14,0x22,0x41,0x00}, // 0x3C '<'
+    {0x14,0x14,0x14,0x14,0x14}, // 0x3D '='
+    {0x00,0x41,0x22,0x14,0x08}, // 0x3E '>'
+    {0x02,0x01,0x51,0x09,0x06}, // 0x3F '?'
+    {0x32,0x49,0x79,0x41,0x3E}, // 0x40 '@'
+    {0x7E,0x11,0x11,0x11,0x7E}, // 0x41 'A'
+    {0x7F,0x49,0x49,0x49,0x36}, // 0x42 'B'
+    {0x3E,0x41,0x41,0x41,0x22}, // 0x43 'C'
+    {0x7F,0x41,0x41,0x22,0x1C}, // 0x44 'D'
+    {0x7F,0x49,0x49,0x49,0x41}, // 0x45 'E'
+    {0x7F,0x09,0x09,0x09,0x01}, // 0x46 'F'
+    {0x3E,0x41,0x49,0x49,0x7A}, // 0x47 'G'
+    {0x7F,0x08,0x08,0x08,0x7F}, // 0x48 'H'
+    {0x00,0x41,0x7F,0x41,0x00}, // 0x49 'I'
+    {0x20,0x40,0x41,0x3F,0x01}, // 0x4A 'J'
+    {0x7F,0x08,0x14,0x22,0x41}, // 0x4B 'K'
+    {0x7F,0x40,0x40,0x40,0x40}, // 0x4C 'L'
+    {0x7F,0x02,0x0C,0x02,0x7F}, // 0x4D 'M'
+    {0x7F,0x04,0x08,0x10,0x7F}, // 0x4E 'N'
+    {0x3E,0x41,0x41,0x41,0x3E}, // 0x4F 'O'
+    {0x7F,0x09,0x09,0x09,0x06}, // 0x50 'P'
+    {0x3E,0x41,0x51,0x21,0x5E}, // 0x51 'Q'
+    {0x7F,0x09,0x19,0x29,0x46}, // 0x52 'R'
+    {0x46,0x49,0x49,0x49,0x31}, // 0x53 'S'
+    {0x01,0x01,0x7F,0x01,0x01}, // 0x54 'T'
+    {0x3F,0x40,0x40,0x40,0x3F}, // 0x55 'U'
+    {0x1F,0x20,0x40,0x20,0x1F}, // 0x56 'V'
+    {0x3F,0x40,0x38,0x40,0x3F}, // 0x57 'W'
+    {0x63,0x14,0x08,0x14,0x63}, // 0x58 'X'
+    {0x07,0x08,0x70,0x08,0x07}, // 0x59 'Y'
+    {0x61,0x51,0x49,0x45,0x43}, // 0x5A 'Z'
+    {0x00,0x7F,0x41,0x41,0x00}, // 0x5B '['
+    {0x02,0x04,0x08,0x10,0x20}, // 0x5C '\\'
+    {0x00,0x41,0x41,0x7F,0x00}, // 0x5D ']'
+    {0x04,0x02,0x01,0x02,0x04}, // 0x5E '^'
+    {0x40,0x40,0x40,0x40,0x40}, // 0x5F '_'
+    {0x00,0x01,0x02,0x04,0x00}, // 0x60 '`'
+    {0x20,0x54,0x54,0x54,0x78}, // 0x61 'a'
+    {0x7F,0x48,0x44,0x44,0x38}, // 0x62 'b'
+    {0x38,0x44,0x44,0x44,0x20}, // 0x63 'c'
+    {0x38,0x44,0x44,0x48,0x7F}, // 0x64 'd'
+    {0x38,0x54,0x54,0x54,0x18}, // 0x65 'e'
+    {0x08,0x7E,0x09,0x01,0x02}, // 0x66 'f'
+    {0x0C,0x52,0x52,0x52,0x3E}, // 0x67 'g'
+    {0x7F,0x08,0x04,0x04,0x78}, // 0x68 'h'
+    {0x00,0x44,0x7D,0x40,0x00}, // 0x69 'i'
+    {0x20,0x40,0x44,0x3D,0x00}, // 0x6A 'j'
+    {0x7F,0x10,0x28,0x44,0x00}, // 0x6B 'k'
+    {0x00,0x41,0x7F,0x40,0x00}, // 0x6C 'l'
+    {0x7C,0x04,0x18,0x04,0x78}, // 0x6D 'm'
+    {0x7C,0x08,0x04,0x04,0x78}, // 0x6E 'n'
+    {0x38,0x44,0x44,0x44,0x38}, // 0x6F 'o'
+    {0x7C,0x14,0x14,0x14,0x08}, // 0x70 'p'
+    {0x08,0x14,0x14,0x18,0x7C}, // 0x71 'q'
+    {0x7C,0x08,0x04,0x04,0x08}, // 0x72 'r'
+    {0x48,0x54,0x54,0x54,0x20}, // 0x73 's'
+    {0x04,0x3F,0x44,0x40,0x20}, // 0x74 't'
+    {0x3C,0x40,0x40,0x20,0x7C}, // 0x75 'u'
+    {0x1C,0x20,0x40,0x20,0x1C}, // 0x76 'v'
+    {0x3C,0x40,0x30,0x40,0x3C}, // 0x77 'w'
+    {0x44,0x28,0x10,0x28,0x44}, // 0x78 'x'
+    {0x0C,0x50,0x50,0x50,0x3C}, // 0x79 'y'
+    {0x44,0x64,0x54,0x4C,0x44}, // 0x7A 'z'
+    {0x00,0x08,0x36,0x41,0x00}, // 0x7B '{'
+    {0x00,0x00,0x7F,0x00,0x00}, // 0x7C '|'
+    {0x00,0x41,0x36,0x08,0x00}, // 0x7D '}'
+    {0x08,0x08,0x2A,0x1C,0x08}, // 0x7E '~'
+};
+const font_t font_5x7 = {
+    .first = 0x20, .last = 0x7E,
+    .height = 7, .width = 5, .spacing = 1,
+    .bitmap = &font5x7_bitmap[0][0],
+};
+
+static int glyph_index(const font_t* f, char c) {
+    unsigned char u = (unsigned char)c;
+    if (u < f->first || u > f->last) u = (f->first <= '?' && '?' <= f->last) ? '?' : f->first;
+    return u - f->first;
+}
+
+static inline int glyph_width(const font_t* f, int i) {
+    return f->widths ? f->widths[i] : f->width;
+}
+
+static inline const uint8_t* glyph_bits(const font_t* f, int i) {
+    if (f->offsets) return &f->bitmap[f->offsets[i]];
+    return &f->bitmap[i * f->width * ((f->height + 7) >> 3)];
+}
+
+// Each glyph byte gets a value and a coverage mask: opaque covers the whole
+// glyph cell (the box padded to whole pages, like a character cell, so a
+// page-aligned opaque glyph is a plain copy), transparent only the set
+// pixels. With y on a page boundary a glyph byte maps onto one framebuffer
+// byte; otherwise it is shifted down by y & 7 and merged into two pages.
+int font_draw_char(ssd1306_t* s, const font_t* f, int x, int y, char c, bool on, bool opaque) {
+    int i = glyph_index(f, c);
+    int gw = glyph_width(f, i);
+    int advance = gw + f->spacing;
+
+    int c0 = x < 0 ? -x : 0;
+    int c1 = gw;
+    if (x + c1 > s->width) c1 = s->width - x;
+    int pages = (f->height + 7) >> 3;
+    int rows = opaque ? pages << 3 : f->height;
+    if (c0 >= c1 || y >= s->height || y + rows <= 0) return advance;
+
+    const uint8_t* g = glyph_bits(f, i);
+    int dst_page = y >> 3;          // Floors for negative y
+    int shift = y & 7;
+
+    int n = c1 - c0;
+    for (int k = 0; k < pages; k++, g += gw) {
+        const uint8_t* src = &g[c0];
+        int left = rows - (k << 3);
+        uint8_t box = left >= 8 ? 0xFF : (uint8_t)((1u << left) - 1);
+        int lo = dst_page + k, hi = lo + 1;
+        bool lo_ok = lo >= 0 && lo < s->pages;
+        bool hi_ok = shift && hi >= 0 && hi < s->pages;
+        // Point at the first visible column, and only into pages that exist
+        uint8_t* dlo = lo_ok ? &s->buf[lo * s->width + x + c0] : NULL;
+        uint8_t* dhi = hi_ok ? &s->buf[hi * s->width + x + c0] : NULL;
+
+        if (!shift) {
+            if (!lo_ok) continue;
+            if (opaque && on && box == 0xFF) {
+                memcpy(dlo, src, n);
+                continue;
+            }
+            for (int col = 0; col < n; col++) {
+                uint8_t b = src[col];
+                uint8_t m = opaque ? box : b;
+                uint8_t v = on ? b : (uint8_t)(~b & box);
+                dlo[col] = (uint8_t)((dlo[col] & ~m) | (v & m));
+            }
+            continue;
+        }
+
+        for (int col = 0; col < n; col++) {
+            uint8_t b = src[col];
+            uint16_t m = (uint16_t)((opaque ? box : b) << shift);
+            uint16_t v = (uint16_t)((on ? b : (uint8_t)(~b & box)) << shift);
+            if (lo_ok) dlo[col] = (uint8_t)((dlo[col] & ~m) | (v & m));
+            if (hi_ok) dhi[col] = (uint8_t)((dhi[col] & ~(m >> 8)) | ((v >> 8) & (m >> 8)));
+        }
+    }
+
+    ssd1306_mark_dirty(s, x + c0, y, n, rows);
+    return advance;
+}
+
+int font_draw_string(ssd1306_t* s, const font_t* f, int x, int y, const char* str, bool on, bool opaque) {
+    while (*str) x += font_draw_char(s, f, x, y, *str++, on, opaque);
+    return x;
+}
+
+int font_text_width(const font_t* f, const char* str) {
+    int w = 0;
+    while (*str) {
+        int i = glyph_index(f, *str++);
+        w += glyph_width(f, i) + f->spacing;
+    }
+    return w;
+}
@@ -0,0 +1,38 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+// Bitmap font. Glyphs are stored page-major like the framebuffer: for each
+// 8-row page, one byte per column (LSB = top row). A fixed-width glyph c
+// starts at (c - first) * width * pages; variable-width fonts (e.g. made by
+// tools/bdf_to_font.py) give each glyph's offset and width instead.
+typedef struct {
+    uint8_t first, last;        // Character range; anything else draws as '?'
+    uint8_t height;             // Glyph rows
+    uint8_t width;              // Glyph columns when widths is NULL
+    uint8_t spacing;            // Blank columns after each glyph
+    const uint8_t* bitmap;
+    const uint16_t* offsets;    // Variable width: start of each glyph, or NULL
+    const uint8_t* widths;      // Variable width: columns of each glyph, or NULL
+} font_t;
+
+// Standard ASCII 5x7 (0x20-0x7E), 1 column spacing
+extern const font_t font_5x7;
+
+// Draw one glyph with its top-left corner at x,y. Opaque also clears the
+// glyph cell around the set pixels: the glyph box padded down to whole
+// pages (row 7 for font_5x7), like a character cell. Otherwise only set
+// pixels are drawn.
+// Returns the advance (glyph width + spacing).
+int font_draw_char(ssd1306_t* s, const font_t* f, int x, int y, char c, bool on, bool opaque);
+
+// Draw a string; returns the x after the last glyph
+int font_draw_string(ssd1306_t* s, const font_t* f, int x, int y, const char* str, bool on, bool opaque);
+
+// Width in pixels of a string, including spacing after the last glyph
+int font_text_width(const font_t* f, const char* str);
+
+#endif
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Convert a BDF bitmap font into a picoF font_t (see font/font.h).
+
+Usage: bdf_to_font.py FONT.bdf NAME [--first 32] [--last 126] [--spacing 1] > font_NAME.c
+
+Glyphs are cropped to their advance width (DWIDTH) and placed on a common
+baseline, so the result is a variable-width font with one height. Columns
+are emitted page-major (LSB = top row), matching the framebuffer.
+"""
+import argparse
+import sys
+
+
+def parse_bdf(path):
+    font = {"ascent": None, "descent": None, "bbx": None, "glyphs": {}}
+    glyph = None
+    rows = None
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            parts = line.split()
+            if not parts:
+                continue
+            key = parts[0]
+            if rows is not None:
+                if key == "ENDCHAR":
+                    glyph["rows"] = rows
+                    if glyph["encoding"] >= 0:
+                        font["glyphs"][glyph["encoding"]] = glyph
+                    glyph, rows = None, None
+                else:
+                    rows.append(int(key, 16))
+            elif key == "FONTBOUNDINGBOX":
+                font["bbx"] = tuple(int(v) for v in parts[1:5])
+            elif key == "FONT_ASCENT":
+                font["ascent"] = int(parts[1])
+            elif key == "FONT_DESCENT":
+                font["descent"] = int(parts[1])
+            elif key == "STARTCHAR":
+                glyph = {"encoding": -1, "dwidth": None, "bbx": None}
+            elif key == "ENCODING" and glyph is not None:
+                glyph["encoding"] = int(parts[1])
+            elif key == "DWIDTH" and glyph is not None:
+                glyph["dwidth"] = int(parts[1])
+            elif key == "BBX" and glyph is not None:
+                glyph["bbx"] = tuple(int(v) for v in parts[1:5])
+            elif key == "BITMAP" and glyph is not None:
+                rows = []
+    if font["ascent"] is None or font["descent"] is None:
+        fw, fh, fx, fy = font["bbx"]
+        font["ascent"], font["descent"] = fh + fy, -fy
+    return font
+
+
+def render(font, glyph):
+    """Return (width, set of (x, y)) with y measured from the top of the cell."""
+    bw, bh, bx, by = glyph["bbx"]
+    width = glyph["dwidth"] if glyph["dwidth"] is not None else bw + bx
+    row_bits = (bw + 7) // 8 * 8
+    pixels = set()
+    top = font["ascent"] - (by + bh)
+    for r, bits in enumerate(glyph["rows"]):
+        for c in range(bw):
+            if bits & (1 << (row_bits - 1 - c)):
+                x, y = bx + c, top + r
+                if 0 <= x < width:
+                    pixels.add((x, y))
+    return width, pixels
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("bdf")
+    ap.add_argument("name")
+    ap.add_argument("--first", type=int, default=0x20)
+    ap.add_argument("--last", type=int, default=0x7E)
+    ap.add_argument("--spacing", type=int, default=1)
+    args = ap.parse_args()
+
+    font = parse_bdf(args.bdf)
+    height = font["ascent"] + font["descent"]
+    pages = (height + 7) // 8
+    if height <= 0 or height > 64:
+        sys.exit("unsupported font height %d" % height)
+
+    bitmap, offsets, widths = [], [], []
+    for code in range(args.first, args.last + 1):
+        glyph = font["glyphs"].get(code) or font["glyphs"].get(ord("?"))
+        width, pixels = render(font, glyph) if glyph else (0, set())
+        offsets.append(len(bitmap))
+        widths.append(width)
+        for page in range(pages):
+            for x in range(width):
+                byte = 0
+                for bit in range(8):
+                    if (x, page * 8 + bit) in pixels:
+                        byte |= 1 << bit
+                bitmap.append(byte)
+
+    if len(bitmap) > 0xFFFF:
+        sys.exit("font too large for 16-bit glyph offsets")
+
+    n = args.name
+    out = sys.stdout
+    out.write("// Generated by font/tools/bdf_to_font.py from %s\n" % args.bdf.split("/")[-1])
+    out.write('#include "font.h"\n\n')
+    out.write("static const uint8_t %s_bitmap[%d] = {\n" % (n, len(bitmap)))
+    for i in range(0, len(bitmap), 16):
+        out.write("    " + ",".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+    out.write("static const uint16_t %s_offsets[%d] = {\n" % (n, len(offsets)))
+    for i in range(0, len(offsets), 12):
+        out.write("    " + ",".join("%d" % o for o in offsets[i:i + 12]) + ",\n")
+    out.write("};\n\n")
+    out.write("static const uint8_t %s_widths[%d] = {\n" % (n, len(widths)))
+    for i in range(0, len(widths), 16):
+        out.write("    " + ",".join("%d" % w for w in widths[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+    out.write("const font_t font_%s = {\n" % n)
+    out.write("    .first = 0x%02X, .last = 0x%02X,\n" % (args.first, args.last))
+    out.write("    .height = %d, .spacing = %d,\n" % (height, args.spacing))
+    out.write("    .bitmap = %s_bitmap,\n" % n)
+    out.write("    .offsets = %s_offsets,\n" % n)
+    out.write("    .widths = %s_widths,\n" % n)
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
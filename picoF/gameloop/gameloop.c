@@ -0,0 +1,101 @@
+#include "gameloop.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/time.h"
+
+void gameloop_init(gameloop_t* g, uint32_t step_us,
+                   bool (*update)(void* user), void (*render)(void* user, uint8_t alpha),
+                   void* user) {
+    memset(g, 0, sizeof(*g));
+    g->step_us = step_us;
+    g->update = update;
+    g->render = render;
+    g->user = user;
+}
+
+static void record(gameloop_t* g, uint32_t us) {
+    gameloop_stats_t* s = &g->stats;
+    if (s->frames == 0 || us < s->min_us) s->min_us = us;
+    if (us > s->max_us) s->max_us = us;
+    s->frames++;
+    g->sum_us += us;
+
+    uint32_t b = us / GAMELOOP_HIST_US;
+    if (b >= GAMELOOP_HIST_BUCKETS) b = GAMELOOP_HIST_BUCKETS - 1;
+    g->hist[b]++;
+}
+
+void gameloop_run(gameloop_t* g) {
+    const uint32_t step = g->step_us;
+    const uint32_t period = g->frame_us ? g->frame_us : step;
+
+    memset(&g->stats, 0, sizeof(g->stats));
+    memset(g->hist, 0, sizeof(g->hist));
+    g->sum_us = 0;
+
+    absolute_time_t last = get_absolute_time();
+    absolute_time_t deadline = last;
+    uint32_t acc = step;    // First frame simulates one step straight away
+
+    while (true) {
+        absolute_time_t start = get_absolute_time();
+        acc += (uint32_t)absolute_time_diff_us(last, start);
+        last = start;
+
+        int steps = 0;
+        while (acc >= step) {
+            if (steps == GAMELOOP_MAX_STEPS) {
+                // Too far behind to catch up: drop whole steps, keep the phase
+                g->stats.dropped_steps += acc / step;
+                acc %= step;
+                break;
+            }
+            if (!g->update(g->user)) return;
+            acc -= step;
+            steps++;
+        }
+        g->stats.steps += steps;
+
+        if (g->render) g->render(g->user, (uint8_t)(((uint64_t)acc << 8) / step));
+        absolute_time_t end = get_absolute_time();
+        record(g, (uint32_t)absolute_time_diff_us(start, end));
+
+        deadline = delayed_by_us(deadline, period);
+        if (absolute_time_diff_us(end, deadline) < 0) {
+            g->stats.late++;
+            deadline = end;
+        } else {
+            sleep_until(deadline);
+        }
+    }
+}
+
+void gameloop_get_stats(const gameloop_t* g, gameloop_stats_t* out) {
+    *out = g->stats;
+    if (!out->frames) return;
+    out->avg_us = (uint32_t)(g->sum_us / out->frames);
+
+    // Upper edge of the bucket holding the 99th percentile, capped at max
+    uint32_t want = out->frames - out->frames / 100;
+    uint32_t seen = 0;
+    out->p99_us = out->max_us;
+    for (int b = 0; b < GAMELOOP_HIST_BUCKETS - 1; b++) {
+        seen += g->hist[b];
+        if (seen >= want) {
+            uint32_t edge = (uint32_t)(b + 1) * GAMELOOP_HIST_US;
+            if (edge < out->max_us) out->p99_us = edge;
+            break;
+        }
+    }
+}
+
+void gameloop_report(const gameloop_t* g, const char* tag) {
+    gameloop_stats_t s;
+    gameloop_get_stats(g, &s);
+    printf("%s: %lu frames, %lu steps @ %lu us (%lu late, %lu dropped), "
+           "frame min/avg/max/p99 %lu/%lu/%lu/%lu us\n",
+           tag, (unsigned long)s.frames, (unsigned long)s.steps, (unsigned long)g->step_us,
+           (unsigned long)s.late, (unsigned long)s.dropped_steps,
+           (unsigned long)s.min_us, (unsigned long)s.avg_us,
+           (unsigned long)s.max_us, (unsigned long)s.p99_us);
+}
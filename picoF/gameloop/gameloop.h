@@ -0,0 +1,55 @@
+#ifndef GAMELOOP_H
+#define GAMELOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fixed-timestep loop: update() runs at exactly step_us of simulated time
+// per call, catching up on real time through an accumulator; render() runs
+// once per frame with the leftover fraction of a step (Q8, 0..255) for
+// interpolation. Frames start on absolute deadlines, so time spent in
+// update/render/present doesn't stretch the period.
+
+// Catch-up steps per frame before the excess time is dropped
+#ifndef GAMELOOP_MAX_STEPS
+#define GAMELOOP_MAX_STEPS 4
+#endif
+
+// Frame time histogram for the p99: buckets of GAMELOOP_HIST_US, the last
+// one collects everything slower
+#define GAMELOOP_HIST_US      500
+#define GAMELOOP_HIST_BUCKETS 64
+
+typedef struct {
+    uint32_t frames;
+    uint32_t steps;
+    uint32_t late;              // Frames that missed their deadline
+    uint32_t dropped_steps;     // Steps skipped past GAMELOOP_MAX_STEPS
+    uint32_t min_us, avg_us, max_us, p99_us;   // update + render per frame
+} gameloop_stats_t;
+
+typedef struct {
+    uint32_t step_us;           // Simulation step
+    uint32_t frame_us;          // Frame period (0 = one frame per step)
+    bool (*update)(void* user);                 // One step; false stops the loop
+    void (*render)(void* user, uint8_t alpha);  // Optional
+    void* user;
+
+    gameloop_stats_t stats;
+    uint64_t sum_us;
+    uint32_t hist[GAMELOOP_HIST_BUCKETS];
+} gameloop_t;
+
+void gameloop_init(gameloop_t* g, uint32_t step_us,
+                   bool (*update)(void* user), void (*render)(void* user, uint8_t alpha),
+                   void* user);
+
+// Run until update() returns false. Stats start from zero on every run.
+void gameloop_run(gameloop_t* g);
+
+void gameloop_get_stats(const gameloop_t* g, gameloop_stats_t* out);
+
+// printf one line of stats, prefixed with tag
+void gameloop_report(const gameloop_t* g, const char* tag);
+
+#endif
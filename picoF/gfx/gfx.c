@@ -1,7 +1,9 @@
 #include <string.h>
 
 #include "gfx.h"
+#include "font.h"
 #include "hardware_init.h"
+#include "perf.h"
 
 
 static ssd1306_t* G = NULL;
@@ -12,7 +14,12 @@ void gfx_init(ssd1306_t* disp) { G = disp; }
 
 void gfx_clear(void) { if (G) ssd1306_clear(G); }
 
-void gfx_show(void) { if (G) ssd1306_show(G); }
+void gfx_show(void) {
+    if (!G) return;
+    perf_overlay_draw();
+    PERF_SCOPE(PERF_PRESENT) ssd1306_present_async(G);
+    perf_frame();
+}
 
 
 
@@ -26,19 +33,13 @@ void gfx_plot(int x, int y, bool on) {
 
 
 
-void gfx_hline(int x, int y, int w, bool on) {
+void gfx_hline(int x, int y, int w, bool on) { if (G) ssd1306_hline(G, x, y, w, on); }
 
-    for (int i = 0; i < w; i++) gfx_plot(x + i, y, on);
+void gfx_vline(int x, int y, int h, bool on) { if (G) ssd1306_vline(G, x, y, h, on); }
 
-}
+void gfx_fill_rect(int x, int y, int w, int h, bool on) { if (G) ssd1306_rect(G, x, y, w, h, on); }
 
-void gfx_fill_rect(int x, int y, int w, int h, bool on) {
-    for (int yy = 0; yy < h; yy++) {
-        for (int xx = 0; xx < w; xx++) {
-            gfx_plot(x + xx, y + yy, on);
-        }
-    }
-}
+void gfx_invert_rect(int x, int y, int w, int h) { if (G) ssd1306_invert_rect(G, x, y, w, h); }
 
 
 void gfx_sprite_rows(int x, int y, int w, int h, const char* rows[]) {
@@ -63,119 +64,83 @@ void gfx_sprite_rows(int x, int y, int w, int h, const char* rows[]) {
 
 
 
-// 5x7 uppercase alphabet + digits + space. Each byte is a column (LSB=top)
-
-static const uint8_t F_AZ_5x7[26][5] = {
-
-    {0x7E,0x11,0x11,0x7E,0x00}, // A
-
-    {0x7F,0x49,0x49,0x36,0x00}, // B
-
-    {0x3E,0x41,0x41,0x22,0x00}, // C
-
-    {0x7F,0x41,0x41,0x3E,0x00}, // D
-
-    {0x7F,0x49,0x49,0x41,0x00}, // E
-
-    {0x7F,0x09,0x09,0x01,0x00}, // F
-
-    {0x3E,0x41,0x51,0x32,0x00}, // G
-
-    {0x7F,0x08,0x08,0x7F,0x00}, // H
-
-    {0x41,0x7F,0x41,0x00,0x00}, // I
-
-    {0x20,0x40,0x41,0x3F,0x00}, // J
-
-    {0x7F,0x08,0x14,0x63,0x00}, // K
-
-    {0x7F,0x40,0x40,0x40,0x00}, // L
-
-    {0x7F,0x02,0x04,0x02,0x7F}, // M
-
-    {0x7F,0x04,0x08,0x7F,0x00}, // N
-
-    {0x3E,0x41,0x41,0x3E,0x00}, // O
-
-    {0x7F,0x09,0x09,0x06,0x00}, // P
-
-    {0x3E,0x41,0x61,0x3E,0x00}, // Q
-
-    {0x7F,0x09,0x19,0x66,0x00}, // R
-
-    {0x26,0x49,0x49,0x32,0x00}, // S
-
-    {0x01,0x7F,0x01,0x01,0x00}, // T
-
-    {0x3F,0x40,0x40,0x3F,0x00}, // U
-
-    {0x1F,0x20,0x40,0x20,0x1F}, // V
-
-    {0x7F,0x20,0x18,0x20,0x7F}, // W
-
-    {0x63,0x14,0x08,0x14,0x63}, // X
-
-    {0x07,0x08,0x70,0x08,0x07}, // Y
-
-    {0x61,0x51,0x49,0x45,0x43}, // Z
-
-};
-
-
+void gfx_sprite_pack(gfx_sprite_t* spr, uint8_t* bits, uint8_t* mask, int w, int h, const char* rows[]) {
+    memset(bits, 0, GFX_SPRITE_BYTES(w, h));
+    if (mask) memset(mask, 0, GFX_SPRITE_BYTES(w, h));
 
-static const uint8_t F_09_5x7[10][5] = {
-
-    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0
-
-    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 1
-
-    {0x42, 0x61, 0x51, 0x49, 0x46}, // 2
-
-    {0x22, 0x41, 0x49, 0x49, 0x36}, // 3
-
-    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 4
-
-    {0x2F, 0x49, 0x49, 0x49, 0x31}, // 5
-
-    {0x3E, 0x49, 0x49, 0x49, 0x30}, // 6
-
-    {0x01, 0x71, 0x09, 0x05, 0x03}, // 7
-
-    {0x36, 0x49, 0x49, 0x49, 0x36}, // 8
-
-    {0x06, 0x49, 0x49, 0x49, 0x3E}  // 9
-
-};
+    for (int r = 0; r < h; r++) {
+        const char* line = rows[r];
+        uint8_t bit = (uint8_t)(1u << (r & 7));
+        int base = (r >> 3) * w;
+        for (int c = 0; c < w; c++) {
+            char ch = line[c];
+            if (ch == '#' || ch == '1' || ch == 'X') bits[base + c] |= bit;
+            if (mask && ch != '.') mask[base + c] |= bit;
+        }
+    }
 
+    spr->w = (uint8_t)w;
+    spr->h = (uint8_t)h;
+    spr->bits = bits;
+    spr->mask = mask;
+}
 
+// Each sprite byte lands in one or two framebuffer pages: shifted down by
+// y & 7, low half into page y >> 3 (+ sprite page), high half into the next.
+static inline void blit_byte(uint8_t* dst, uint8_t bits, uint8_t cov, gfx_blit_t mode) {
+    switch (mode) {
+    case GFX_BLIT_OR:   *dst |= bits; break;
+    case GFX_BLIT_AND:  *dst &= (uint8_t)(bits | ~cov); break;
+    case GFX_BLIT_XOR:  *dst ^= bits; break;
+    case GFX_BLIT_MASK: *dst = (uint8_t)((*dst & ~cov) | (bits & cov)); break;
+    }
+}
 
-static const uint8_t F_SPACE_5x7[5] = {0,0,0,0,0};
+void gfx_blit(int x, int y, const gfx_sprite_t* spr, gfx_blit_t mode) {
+    if (!G || !spr) return;
+
+    int c0 = x < 0 ? -x : 0;
+    int c1 = spr->w;
+    if (x + c1 > G->width) c1 = G->width - x;
+    if (c0 >= c1 || y >= G->height || y + spr->h <= 0) return;
+
+    int spr_pages = (spr->h + 7) >> 3;
+    int dst_page = y >> 3;          // Floors for negative y
+    int shift = y & 7;
+
+    for (int k = 0; k < spr_pages; k++) {
+        int rows = spr->h - (k << 3);
+        uint8_t box = rows >= 8 ? 0xFF : (uint8_t)((1u << rows) - 1);
+        int lo = dst_page + k, hi = lo + 1;
+        bool lo_ok = lo >= 0 && lo < G->pages;
+        bool hi_ok = shift && hi >= 0 && hi < G->pages;
+        if (!lo_ok && !hi_ok) continue;
+
+        const uint8_t* bits = &spr->bits[k * spr->w];
+        const uint8_t* mask = spr->mask ? &spr->mask[k * spr->w] : NULL;
+        int dlo = lo * G->width + x;
+        int dhi = hi * G->width + x;
+
+        for (int c = c0; c < c1; c++) {
+            uint16_t b = (uint16_t)(bits[c] << shift);
+            uint16_t m = (uint16_t)((mask ? mask[c] : box) << shift);
+            if (lo_ok) blit_byte(&G->buf[dlo + c], (uint8_t)b, (uint8_t)m, mode);
+            if (hi_ok) blit_byte(&G->buf[dhi + c], (uint8_t)(b >> 8), (uint8_t)(m >> 8), mode);
+        }
+    }
 
+    ssd1306_mark_dirty(G, x + c0, y, c1 - c0, spr->h);
+}
 
+// Text uses the shared 5x7 font; lowercase maps to uppercase as before
 
 void gfx_char5x7(int x, int y, char ch, bool on) {
 
-    const uint8_t* glyph = F_SPACE_5x7;
-
-    if (ch >= 'A' && ch <= 'Z') glyph = F_AZ_5x7[ch - 'A'];
-
-    else if (ch >= 'a' && ch <= 'z') glyph = F_AZ_5x7[ch - 'a']; // map lowercase to uppercase
-
-    else if (ch >= '0' && ch <= '9') glyph = F_09_5x7[ch - '0'];
-
-
-
-    for (int col = 0; col < 5; col++) {
-
-        uint8_t bits = glyph[col];
-
-        for (int row = 0; row < 7; row++) {
-
-            if (bits & (1u << row)) gfx_plot(x + col, y + row, on);
+    if (!G) return;
 
-        }
+    if (ch >= 'a' && ch <= 'z') ch = (char)(ch - 'a' + 'A');
 
-    }
+    font_draw_char(G, &font_5x7, x, y, ch, on, false);
 
 }
 
@@ -187,8 +152,6 @@ void gfx_text5x7(int x, int y, const char* str, bool on) {
 
     while (*str) {
 
-        if (*str == ' ') { cx += 6; str++; continue; }
-
         gfx_char5x7(cx, y, *str, on);
 
         cx += 6; // 5px + 1px space
@@ -208,8 +171,15 @@ void oled_present_mono_1bpp(const uint8_t *buf) {
 
     // Fast path: exact 128x64 copy
     if (disp.width == 128 && disp.height == 64) {
+        // Whole-frame content: one window + one transaction beats per-page diffs
+        uint8_t mode = disp.present_mode;
         memcpy(disp.buf, buf, 1024);
-        ssd1306_show(&disp);
+        ssd1306_mark_dirty(&disp, 0, 0, 128, 64);
+        ssd1306_set_present_mode(&disp, SSD1306_PRESENT_FULL);
+        perf_overlay_draw();
+        PERF_SCOPE(PERF_PRESENT) ssd1306_present_async(&disp);
+        ssd1306_set_present_mode(&disp, (ssd1306_present_t)mode);
+        perf_frame();
         return;
     }
 
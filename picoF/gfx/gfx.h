@@ -30,13 +30,17 @@ void gfx_plot(int x, int y, bool on);
 
 void gfx_hline(int x, int y, int w, bool on);
 
+void gfx_vline(int x, int y, int h, bool on);
+
 void gfx_fill_rect(int x, int y, int w, int h, bool on);
 
+void gfx_invert_rect(int x, int y, int w, int h);
+
 void oled_present_mono_1bpp(const uint8_t *buf);
 
 
 
-// 5x7 uppercase + digits font rendering (A-Z, 0-9, space)
+// 5x7 text (printable ASCII, lowercase drawn as uppercase)
 
 void gfx_char5x7(int x, int y, char ch, bool on);
 
@@ -50,6 +54,58 @@ void gfx_sprite_rows(int x, int y, int w, int h, const char* rows[]);
 
 
 
+// Packed sprite, page-major like the framebuffer: byte [page * w + x] holds
+
+// rows page*8 .. page*8+7 of column x (LSB = top). mask marks the pixels
+
+// the sprite covers in GFX_BLIT_MASK mode; NULL covers the whole box.
+
+typedef struct {
+
+    uint8_t w, h;
+
+    const uint8_t* bits;
+
+    const uint8_t* mask;
+
+} gfx_sprite_t;
+
+
+
+#define GFX_SPRITE_BYTES(w, h) ((w) * (((h) + 7) / 8))
+
+
+
+typedef enum {
+
+    GFX_BLIT_OR,    // Set sprite pixels
+
+    GFX_BLIT_AND,   // Clear pixels that are off in the sprite box
+
+    GFX_BLIT_XOR,   // Flip sprite pixels
+
+    GFX_BLIT_MASK,  // Copy sprite pixels where the mask is set
+
+} gfx_blit_t;
+
+
+
+// Pack rows of ASCII art into bits (and mask, if not NULL), each
+
+// GFX_SPRITE_BYTES(w, h) long. '#', '1' and 'X' are set, '.' is transparent
+
+// and any other character is an opaque clear pixel.
+
+void gfx_sprite_pack(gfx_sprite_t* spr, uint8_t* bits, uint8_t* mask, int w, int h, const char* rows[]);
+
+
+
+// Draw a packed sprite with its top-left corner at x,y (clipped)
+
+void gfx_blit(int x, int y, const gfx_sprite_t* spr, gfx_blit_t mode);
+
+
+
 #ifdef __cplusplus
 
 }
@@ -2,6 +2,55 @@
 #define HARDWARE_CONFIG_H
 
 #include "hardware/i2c.h"
+#include "hardware/spi.h"
+
+// Display bus: 0 = I²C, 1 = 4-wire SPI
+#ifndef DISPLAY_SPI
+#define DISPLAY_SPI 0
+#endif
+
+// Present service: 1 = core 1 drives the display bus, 0 = DMA from core 0
+#ifndef DISPLAY_CORE1
+#define DISPLAY_CORE1 1
+#endif
+
+// Launcher idle clock in kHz, restored when a program starts (0 = stay at
+// full speed)
+#ifndef IDLE_SYS_KHZ
+#define IDLE_SYS_KHZ 48000
+#endif
+
+// Bus profiler: 1 = stream display bus traffic summaries over stdio every
+// BUS_PROFILE_PERIOD_MS while frames are presented (see busprof/busprof.h)
+#ifndef BUS_PROFILE
+#define BUS_PROFILE 0
+#endif
+#ifndef BUS_PROFILE_PERIOD_MS
+#define BUS_PROFILE_PERIOD_MS 1000
+#endif
+
+// PC sampling profiler: 1 = profile each program at PC_PROFILE_HZ and print
+// the histogram over stdio when it exits (see prof/prof.h)
+#ifndef PC_PROFILE
+#define PC_PROFILE 0
+#endif
+#ifndef PC_PROFILE_HZ
+#define PC_PROFILE_HZ 1000
+#endif
+
+// Asset pack region in flash (see assets/assets.h). The firmware must end
+// below it; picoF_add_asset_pack places the pack's UF2 at the same offset.
+#ifndef ASSET_PACK_OFFSET
+#define ASSET_PACK_OFFSET 0x100000
+#endif
+#ifndef ASSET_PACK_SIZE
+#define ASSET_PACK_SIZE 0x100000
+#endif
+
+// SRAM for asset_prefetch() copies of hot assets (> 0)
+#ifndef ASSET_SRAM_POOL
+#define ASSET_SRAM_POOL 16384
+#endif
 
 // I²C config
 #define I2C_PORT i2c1
@@ -9,6 +58,15 @@
 #define SCL_PIN 27
 #define I2C_BAUD 400000
 
+// SPI config
+#define SPI_PORT spi0
+#define SPI_SCK_PIN  18
+#define SPI_MOSI_PIN 19
+#define SPI_CS_PIN   17
+#define SPI_DC_PIN   20
+#define SPI_RST_PIN  21
+#define SPI_BAUD 10000000
+
 // Button pins
 #define BTN0 7
 #define BTN1 8
@@ -2,18 +2,39 @@
 #include "hardware_init.h"
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "hardware/spi.h"
+#include "hardware/clocks.h"
+#include "ssd1306_transport.h"
+#include "present.h"
+#include "busprof.h"
 
 ssd1306_t disp;
 
+#if DISPLAY_SPI
+static ssd1306_spi_t disp_spi;
+#else
+static ssd1306_i2c_t disp_i2c;
+#endif
+
+static uint32_t full_sys_khz;
+static bool idle;
+
 void hardware_init(void) {
     stdio_init_all();
 
+#if DISPLAY_SPI
+    // SPI setup
+    spi_init(SPI_PORT, SPI_BAUD);
+    gpio_set_function(SPI_SCK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(SPI_MOSI_PIN, GPIO_FUNC_SPI);
+#else
     // I²C setup
     i2c_init(I2C_PORT, I2C_BAUD);
     gpio_set_function(SDA_PIN, GPIO_FUNC_I2C);
     gpio_set_function(SCL_PIN, GPIO_FUNC_I2C);
     gpio_pull_up(SDA_PIN);
     gpio_pull_up(SCL_PIN);
+#endif
 /*
     // Buttons
     gpio_init(BTN_JUMP);
@@ -28,7 +49,36 @@ void hardware_init(void) {
     gpio_set_dir(BTN_RESTART, GPIO_IN);
     gpio_pull_down(BTN_RESTART);
 */
-    // Display
-    ssd1306_init(&disp, I2C_PORT, 0x3C, 128, 64);
+    // Display: the driver talks to the present service's proxy, which owns
+    // the bus transport
+#if DISPLAY_SPI
+    ssd1306_spi_transport(&disp_spi, SPI_PORT, SPI_DC_PIN, SPI_CS_PIN, SPI_RST_PIN);
+    ssd1306_transport_t* bus = &disp_spi.base;
+#else
+    ssd1306_i2c_transport(&disp_i2c, I2C_PORT, 0x3C);
+    ssd1306_transport_t* bus = &disp_i2c.base;
+#endif
+    ssd1306_init_transport(&disp, present_start(bus, DISPLAY_CORE1), 128, 64);
+    busprof_init(&disp);
+}
+
+void hardware_set_idle(bool on) {
+#if IDLE_SYS_KHZ
+    if (on == idle) return;
+    if (!full_sys_khz) full_sys_khz = clock_get_hz(clk_sys) / 1000;
+
+    // clk_peri follows clk_sys, so nothing may be on the bus across the
+    // switch and the bus divider has to be set again afterwards
+    ssd1306_wait_present(&disp);
+    if (!set_sys_clock_khz(on ? IDLE_SYS_KHZ : full_sys_khz, false)) return;
+    idle = on;
+#if DISPLAY_SPI
+    spi_set_baudrate(SPI_PORT, SPI_BAUD);
+#else
+    i2c_set_baudrate(I2C_PORT, I2C_BAUD);
+#endif
+#else
+    (void)on;
+#endif
 }
 
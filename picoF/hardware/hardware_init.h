@@ -9,4 +9,8 @@ extern ssd1306_t disp;
 
 void hardware_init(void);
 
+// Drop clk_sys to IDLE_SYS_KHZ (true) or back to full speed (false). The
+// display bus clock is re-derived, so the panel keeps working either way.
+void hardware_set_idle(bool idle);
+
 #endif
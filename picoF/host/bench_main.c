@@ -0,0 +1,104 @@
+// Host runner for the benchmark suite (bench/bench.h). Times with the
+// monotonic clock; cycles come from perf_event_open when the kernel allows
+// it, otherwise the column is left empty.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "pico/stdlib.h"
+#include "bench/bench.h"
+#include "gfx/gfx.h"
+#include "hardware_init.h"
+
+static int s_perf_fd = -1;
+static struct timespec s_t0;
+static uint64_t s_c0;
+
+static void counter_open(void) {
+#ifdef __linux__
+    struct perf_event_attr a;
+    memset(&a, 0, sizeof(a));
+    a.type = PERF_TYPE_HARDWARE;
+    a.size = sizeof(a);
+    a.config = PERF_COUNT_HW_CPU_CYCLES;
+    a.exclude_kernel = 1;
+    a.exclude_hv = 1;
+    s_perf_fd = (int)syscall(SYS_perf_event_open, &a, 0, -1, -1, 0);
+#endif
+}
+
+static uint64_t cycles_read(void) {
+    uint64_t v = 0;
+#ifdef __linux__
+    if (s_perf_fd >= 0 && read(s_perf_fd, &v, sizeof(v)) != sizeof(v)) v = 0;
+#endif
+    return v;
+}
+
+static void host_start(void) {
+    s_c0 = cycles_read();
+    clock_gettime(CLOCK_MONOTONIC, &s_t0);
+}
+
+static bool host_stop(bench_sample_t* out) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    out->cycles = cycles_read() - s_c0;
+    out->ns = (uint64_t)(t1.tv_sec - s_t0.tv_sec) * 1000000000u + (uint64_t)t1.tv_nsec - (uint64_t)s_t0.tv_nsec;
+    return s_perf_fd >= 0;
+}
+
+static void usage(FILE* f) {
+    fprintf(f,
+        "usage: picoF_bench [options] [filter]\n"
+        "  [filter]         run only cases whose name contains this\n"
+        "  --list           list the cases\n"
+        "  --target US      batch length (default 50000)\n"
+        "  --platform NAME  first CSV column (default \"host\")\n");
+}
+
+int main(int argc, char** argv) {
+    const char* filter = NULL;
+    uint32_t target_us = 50000;
+    bench_clock_t clk = { "host", host_start, host_stop };
+
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!strcmp(a, "--list")) {
+            bench_list(stdout);
+            return 0;
+        } else if (!strcmp(a, "--help") || !strcmp(a, "-h")) {
+            usage(stdout);
+            return 0;
+        } else if (a[0] == '-' && a[1] == '-' && !v) {
+            fprintf(stderr, "%s needs a value\n", a);
+            return 2;
+        } else if (!strcmp(a, "--target")) {
+            target_us = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(a, "--platform")) {
+            clk.platform = argv[++i];
+        } else if (a[0] != '-' && !filter) {
+            filter = a;
+        } else {
+            usage(stderr);
+            return 2;
+        }
+    }
+
+    counter_open();
+    stdio_init_all();
+    hardware_init();
+    gfx_init(&disp);
+    if (!bench_run(&clk, filter, target_us ? target_us : 1, stdout)) {
+        fprintf(stderr, "no case matches \"%s\"\n", filter);
+        return 1;
+    }
+    return 0;
+}
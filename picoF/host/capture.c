@@ -0,0 +1,179 @@
+#include "capture.h"
+#include <string.h>
+
+static inline bool lit(const uint8_t* frame, int x, int y) {
+    return (frame[(y / 8) * CAPTURE_W + x] >> (y % 8)) & 1;
+}
+
+bool capture_write_pbm(const char* path, const uint8_t* frame) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P4\n%d %d\n", CAPTURE_W, CAPTURE_H);
+    for (int y = 0; y < CAPTURE_H; y++) {
+        uint8_t row[CAPTURE_W / 8] = { 0 };
+        for (int x = 0; x < CAPTURE_W; x++)
+            if (lit(frame, x, y)) row[x / 8] |= (uint8_t)(0x80 >> (x % 8));
+        fwrite(row, 1, sizeof(row), f);
+    }
+    return fclose(f) == 0;
+}
+
+// ---- PNG --------------------------------------------------------------------
+// 1-bit grayscale, compressed with stored deflate blocks: a frame is only
+// 1 KB, so there is no point pulling in zlib.
+
+#define PNG_ROW   (1 + CAPTURE_W / 8)   // Filter byte + pixels
+#define PNG_RAW   (PNG_ROW * CAPTURE_H)
+#define PNG_ZLIB  (2 + 5 + PNG_RAW + 4)
+
+static uint32_t crc_table[256];
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t* p, size_t n) {
+    if (!crc_table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crc_table[i] = c;
+        }
+    }
+    crc = ~crc;
+    while (n--) crc = crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static void chunk(FILE* f, const char* type, const uint8_t* data, uint32_t n) {
+    uint8_t head[8];
+    put32(head, n);
+    memcpy(&head[4], type, 4);
+    uint32_t crc = crc32_update(crc32_update(0, &head[4], 4), data, n);
+    uint8_t tail[4];
+    put32(tail, crc);
+    fwrite(head, 1, 8, f);
+    if (n) fwrite(data, 1, n, f);
+    fwrite(tail, 1, 4, f);
+}
+
+// zlib stream of the frame's rows; returns its length
+static uint32_t encode_zlib(const uint8_t* frame, uint8_t* out) {
+    uint8_t* p = out;
+    *p++ = 0x78;
+    *p++ = 0x01;
+    *p++ = 0x01;                        // Final stored block, LEN/NLEN LE
+    p[0] = PNG_RAW & 0xFF;
+    p[1] = PNG_RAW >> 8;
+    p[2] = (uint8_t)~p[0];
+    p[3] = (uint8_t)~p[1];
+    p += 4;
+
+    uint8_t* raw = p;
+    for (int y = 0; y < CAPTURE_H; y++) {
+        *p++ = 0;                       // Filter: none
+        memset(p, 0, CAPTURE_W / 8);
+        for (int x = 0; x < CAPTURE_W; x++)
+            if (lit(frame, x, y)) p[x / 8] |= (uint8_t)(0x80 >> (x % 8));
+        p += CAPTURE_W / 8;
+    }
+
+    uint32_t a = 1, b = 0;
+    for (int i = 0; i < PNG_RAW; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(p, (b << 16) | a);
+    return (uint32_t)(p + 4 - out);
+}
+
+static void write_header(FILE* f) {
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(sig, 1, sizeof(sig), f);
+
+    uint8_t ihdr[13] = { 0 };
+    put32(&ihdr[0], CAPTURE_W);
+    put32(&ihdr[4], CAPTURE_H);
+    ihdr[8] = 1;                        // Bit depth
+    ihdr[9] = 0;                        // Grayscale
+    chunk(f, "IHDR", ihdr, sizeof(ihdr));
+}
+
+bool capture_write_png(const char* path, const uint8_t* frame) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    uint8_t z[PNG_ZLIB];
+    write_header(f);
+    chunk(f, "IDAT", z, encode_zlib(frame, z));
+    chunk(f, "IEND", NULL, 0);
+    return fclose(f) == 0;
+}
+
+// ---- APNG -------------------------------------------------------------------
+
+static void write_actl(capture_apng_t* a) {
+    uint8_t actl[8];
+    put32(&actl[0], a->frames);
+    put32(&actl[4], 0);                 // Loop forever
+    chunk(a->f, "acTL", actl, sizeof(actl));
+}
+
+bool capture_apng_open(capture_apng_t* a, const char* path) {
+    memset(a, 0, sizeof(*a));
+    a->f = fopen(path, "wb");
+    if (!a->f) return false;
+    write_header(a->f);
+    a->actl_pos = ftell(a->f);
+    write_actl(a);
+    return true;
+}
+
+// Write the pending frame, shown for ms
+static void flush_frame(capture_apng_t* a, uint64_t ms) {
+    if (ms > 0xFFFF) ms = 0xFFFF;
+    if (ms == 0) ms = 1;
+
+    uint8_t fctl[26] = { 0 };
+    put32(&fctl[0], a->seq++);
+    put32(&fctl[4], CAPTURE_W);
+    put32(&fctl[8], CAPTURE_H);
+    put16(&fctl[20], (uint16_t)ms);
+    put16(&fctl[22], 1000);
+    chunk(a->f, "fcTL", fctl, sizeof(fctl));
+
+    uint8_t z[4 + PNG_ZLIB];
+    uint32_t n = encode_zlib(a->last, &z[4]);
+    if (a->frames == 0) {
+        chunk(a->f, "IDAT", &z[4], n);
+    } else {
+        put32(z, a->seq++);
+        chunk(a->f, "fdAT", z, n + 4);
+    }
+    a->frames++;
+}
+
+void capture_apng_frame(capture_apng_t* a, const uint8_t* frame, uint64_t t_us) {
+    if (a->pending && memcmp(a->last, frame, CAPTURE_BYTES) == 0) return;
+    if (a->pending) flush_frame(a, (t_us - a->last_us + 500) / 1000);
+    memcpy(a->last, frame, CAPTURE_BYTES);
+    a->last_us = t_us;
+    a->pending = true;
+}
+
+void capture_apng_close(capture_apng_t* a, uint64_t end_us) {
+    if (!a->f) return;
+    if (a->pending) flush_frame(a, (end_us - a->last_us + 500) / 1000);
+    chunk(a->f, "IEND", NULL, 0);
+    fseek(a->f, a->actl_pos, SEEK_SET);
+    write_actl(a);
+    fclose(a->f);
+    a->f = NULL;
+}
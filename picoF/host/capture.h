@@ -0,0 +1,43 @@
+#ifndef HOST_CAPTURE_H
+#define HOST_CAPTURE_H
+
+// Frame capture for the simulator. A frame is a 128x64 1bpp image,
+// page-major like the framebuffer (byte [page * 128 + x], LSB on top);
+// lit pixels are 1 in PBM (ink) and white in PNG (glass).
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CAPTURE_W 128
+#define CAPTURE_H 64
+#define CAPTURE_BYTES (CAPTURE_W * CAPTURE_H / 8)
+
+bool capture_write_pbm(const char* path, const uint8_t* frame);
+bool capture_write_png(const char* path, const uint8_t* frame);
+
+// Animated PNG, written as frames come in. Identical consecutive frames are
+// merged into one longer frame.
+typedef struct {
+    FILE* f;
+    uint32_t frames;            // Written so far
+    uint32_t seq;               // APNG sequence number
+    long actl_pos;              // acTL, patched with the count on close
+    bool pending;
+    uint8_t last[CAPTURE_BYTES];
+    uint64_t last_us;
+} capture_apng_t;
+
+bool capture_apng_open(capture_apng_t* a, const char* path);
+void capture_apng_frame(capture_apng_t* a, const uint8_t* frame, uint64_t t_us);
+void capture_apng_close(capture_apng_t* a, uint64_t end_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
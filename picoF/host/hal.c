@@ -0,0 +1,610 @@
+// Pico SDK stand-in for the host build. Implements the parts of the SDK
+// picoF uses on top of virtual time, a pin table and a display bus sink;
+// see host_hal.h for the harness side.
+#include "host_hal.h"
+#include "ssd1306_emu.h"
+#include "hardware_config.h"
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/spi.h"
+#include "hardware/sync.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void unsupported(const char* what) {
+    fprintf(stderr, "host: %s is not supported\n", what);
+    abort();
+}
+
+// ---- Time and alarms --------------------------------------------------------
+
+const absolute_time_t at_the_end_of_time = UINT64_MAX;
+
+#define MAX_ALARMS 32
+
+typedef struct {
+    alarm_id_t id;              // 0 = free
+    absolute_time_t at;
+    alarm_callback_t cb;
+    void* user;
+} alarm_t;
+
+static uint64_t s_now;
+static alarm_t s_alarms[MAX_ALARMS];
+static alarm_id_t s_next_id = 1;
+static volatile bool s_event;
+
+static host_idle_hook_t s_idle_hook;
+static void* s_idle_user;
+
+static alarm_t* next_alarm(void) {
+    alarm_t* next = NULL;
+    for (int i = 0; i < MAX_ALARMS; i++) {
+        alarm_t* a = &s_alarms[i];
+        if (a->id && (!next || a->at < next->at)) next = a;
+    }
+    return next;
+}
+
+static ssd1306_emu_t s_display;
+static bool s_display_ready;
+
+// Move time to t, firing alarms in order on the way
+static void run_until(absolute_time_t t) {
+    uint64_t from = s_now;
+    alarm_t* a;
+    while ((a = next_alarm()) && a->at <= t) {
+        if (a->at > s_now) s_now = a->at;
+        alarm_t fired = *a;
+        a->id = 0;
+
+        // <0: again that long after it was due; >0: that long from now
+        int64_t r = fired.cb(fired.id, fired.user);
+        if (!r) continue;
+        alarm_t* slot = NULL;
+        for (int i = 0; i < MAX_ALARMS && !slot; i++)
+            if (!s_alarms[i].id) slot = &s_alarms[i];
+        if (!slot) unsupported("more than MAX_ALARMS alarms");
+        fired.at = r < 0 ? fired.at + (uint64_t)-r : s_now + (uint64_t)r;
+        *slot = fired;
+    }
+    if (t > s_now) s_now = t;
+    if (s_display_ready) ssd1306_emu_advance_us(&s_display, s_now - from);
+}
+
+// Nothing can wake the program but the harness
+static void idle(void) {
+    if (s_idle_hook && s_idle_hook(s_idle_user)) return;
+    fflush(stdout);
+    exit(0);
+}
+
+uint64_t host_time_us(void) {
+    return s_now;
+}
+
+void host_advance_us(uint64_t us) {
+    run_until(s_now + us);
+}
+
+void host_set_idle_hook(host_idle_hook_t hook, void* user) {
+    s_idle_hook = hook;
+    s_idle_user = user;
+}
+
+absolute_time_t get_absolute_time(void) {
+    return s_now;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)s_now;
+}
+
+uint64_t time_us_64(void) {
+    return s_now;
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us) {
+    return s_now + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms) {
+    return s_now + (uint64_t)ms * 1000;
+}
+
+bool time_reached(absolute_time_t t) {
+    return s_now >= t;
+}
+
+void sleep_until(absolute_time_t t) {
+    while (t == at_the_end_of_time) {
+        alarm_t* a = next_alarm();
+        if (a)
+            run_until(a->at);
+        else
+            idle();
+    }
+    run_until(t);
+}
+
+void sleep_us(uint64_t us) {
+    sleep_until(s_now + us);
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_until(s_now + (uint64_t)ms * 1000);
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout) {
+    if (!s_event) {
+        alarm_t* a = next_alarm();
+        if (a && a->at < timeout) {
+            run_until(a->at);
+        } else if (timeout == at_the_end_of_time) {
+            idle();
+        } else {
+            run_until(timeout);
+            if (!s_event) return true;
+        }
+    }
+    // Woken by an event or an IRQ: the caller rechecks its condition
+    s_event = false;
+    return false;
+}
+
+void __sev(void) {
+    s_event = true;
+}
+
+void __wfe(void) {
+    (void)best_effort_wfe_or_timeout(at_the_end_of_time);
+}
+
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void* user_data, bool fire_if_past) {
+    if (time <= s_now && !fire_if_past) return 0;
+    for (int i = 0; i < MAX_ALARMS; i++) {
+        alarm_t* a = &s_alarms[i];
+        if (a->id) continue;
+        *a = (alarm_t){ s_next_id++, time, callback, user_data };
+        if (s_next_id <= 0) s_next_id = 1;
+        return a->id;
+    }
+    return -1;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void* user_data, bool fire_if_past) {
+    return add_alarm_at(s_now + us, callback, user_data, fire_if_past);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void* user_data, bool fire_if_past) {
+    return add_alarm_at(s_now + (uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id) {
+    for (int i = 0; i < MAX_ALARMS; i++) {
+        if (alarm_id && s_alarms[i].id == alarm_id) {
+            s_alarms[i].id = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- IRQs -------------------------------------------------------------------
+
+#define MAX_GPIO_HANDLERS 8
+
+static bool s_irq_enabled[32];
+static struct {
+    uint32_t mask;
+    irq_handler_t handler;
+} s_gpio_handlers[MAX_GPIO_HANDLERS];
+
+void irq_set_enabled(uint num, bool enabled) {
+    if (num < 32) s_irq_enabled[num] = enabled;
+}
+
+// Only IO_IRQ_BANK0 is ever raised; other handlers are accepted and unused
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+    (void)num;
+    (void)handler;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)num;
+    (void)handler;
+    (void)order_priority;
+}
+
+// ---- GPIO -------------------------------------------------------------------
+
+static struct {
+    bool level;
+    bool driven;                // Set by the harness; pulls no longer apply
+    bool out;
+    uint32_t irq_enabled;
+    uint32_t irq_events;
+} s_pins[NUM_BANK0_GPIOS];
+
+void gpio_init(uint gpio) {
+    if (gpio >= NUM_BANK0_GPIOS) return;
+    s_pins[gpio].out = false;
+    if (!s_pins[gpio].driven) s_pins[gpio].level = false;
+}
+
+void gpio_set_function(uint gpio, gpio_function_t fn) {
+    (void)gpio;
+    (void)fn;
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+    if (gpio < NUM_BANK0_GPIOS) s_pins[gpio].out = out;
+}
+
+void gpio_pull_up(uint gpio) {
+    if (gpio < NUM_BANK0_GPIOS && !s_pins[gpio].driven) s_pins[gpio].level = true;
+}
+
+void gpio_pull_down(uint gpio) {
+    if (gpio < NUM_BANK0_GPIOS && !s_pins[gpio].driven) s_pins[gpio].level = false;
+}
+
+void gpio_put(uint gpio, bool value) {
+    if (gpio < NUM_BANK0_GPIOS && s_pins[gpio].out) s_pins[gpio].level = value;
+}
+
+bool gpio_get(uint gpio) {
+    return gpio < NUM_BANK0_GPIOS && s_pins[gpio].level;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) {
+    if (gpio >= NUM_BANK0_GPIOS) return;
+    if (enabled)
+        s_pins[gpio].irq_enabled |= event_mask;
+    else
+        s_pins[gpio].irq_enabled &= ~event_mask;
+}
+
+void gpio_add_raw_irq_handler_masked(uint32_t gpio_mask, irq_handler_t handler) {
+    for (int i = 0; i < MAX_GPIO_HANDLERS; i++) {
+        if (s_gpio_handlers[i].handler) continue;
+        s_gpio_handlers[i].mask = gpio_mask;
+        s_gpio_handlers[i].handler = handler;
+        return;
+    }
+    unsupported("more than MAX_GPIO_HANDLERS GPIO handlers");
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio) {
+    return gpio < NUM_BANK0_GPIOS ? s_pins[gpio].irq_events : 0;
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) {
+    if (gpio < NUM_BANK0_GPIOS) s_pins[gpio].irq_events &= ~event_mask;
+}
+
+void host_gpio_set(unsigned gpio, bool level) {
+    if (gpio >= NUM_BANK0_GPIOS) return;
+    bool was = s_pins[gpio].level;
+    s_pins[gpio].level = level;
+    s_pins[gpio].driven = true;
+    if (was == level) return;
+
+    uint32_t event = (level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL) & s_pins[gpio].irq_enabled;
+    if (!event) return;
+    s_pins[gpio].irq_events |= event;
+    if (!s_irq_enabled[IO_IRQ_BANK0]) return;
+    for (int i = 0; i < MAX_GPIO_HANDLERS; i++) {
+        if (s_gpio_handlers[i].handler && (s_gpio_handlers[i].mask & (1u << gpio)))
+            s_gpio_handlers[i].handler();
+    }
+}
+
+bool host_gpio_level(unsigned gpio) {
+    return gpio_get(gpio);
+}
+
+// ---- Clocks -----------------------------------------------------------------
+
+static uint32_t s_sys_khz = 125000;
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    switch (clk_index) {
+    case clk_sys:
+    case clk_peri:
+        return s_sys_khz * 1000;
+    case clk_usb:
+    case clk_adc:
+        return 48000000;
+    default:
+        return 12000000;
+    }
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required) {
+    (void)required;
+    s_sys_khz = freq_khz;
+    return true;
+}
+
+// ---- Display bus ------------------------------------------------------------
+
+ssd1306_emu_t* host_display(void) {
+    if (!s_display_ready) {
+        ssd1306_emu_init(&s_display, I2C_BAUD);
+        s_display_ready = true;
+    }
+    return &s_display;
+}
+
+static host_bus_sink_t s_sink;
+static void* s_sink_user;
+static bool s_sink_set;
+
+void host_set_bus_sink(host_bus_sink_t sink, void* user) {
+    s_sink = sink;
+    s_sink_user = user;
+    s_sink_set = true;
+}
+
+static void bus_write(const uint8_t* bytes, size_t n) {
+    if (!s_sink_set)
+        ssd1306_emu_write(host_display(), bytes, n);
+    else if (s_sink)
+        s_sink(s_sink_user, bytes, n);
+}
+
+// Wire time of bits at baud, rounded up
+static uint64_t wire_us(uint64_t bits, uint baud) {
+    return baud ? (bits * 1000000 + baud - 1) / baud : 0;
+}
+
+struct i2c_inst {
+    uint baud;
+    i2c_hw_t hw;
+};
+
+i2c_inst_t i2c0_inst;
+i2c_inst_t i2c1_inst;
+
+uint i2c_init(i2c_inst_t* i2c, uint baudrate) {
+    memset(&i2c->hw, 0, sizeof(i2c->hw));
+    i2c->hw.status = I2C_IC_STATUS_TFE_BITS;
+    return i2c_set_baudrate(i2c, baudrate);
+}
+
+uint i2c_set_baudrate(i2c_inst_t* i2c, uint baudrate) {
+    i2c->baud = baudrate;
+    return baudrate;
+}
+
+static int s_i2c_error;
+static unsigned s_i2c_failures;
+
+void host_i2c_fail(int error, unsigned count) {
+    s_i2c_error = error;
+    s_i2c_failures = count;
+}
+
+int i2c_write_timeout_us(i2c_inst_t* i2c, uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint timeout_us) {
+    (void)addr;
+    (void)nostop;
+    if (s_i2c_failures) {
+        s_i2c_failures--;
+        if (s_i2c_error == PICO_ERROR_TIMEOUT && timeout_us) {
+            run_until(s_now + timeout_us);
+            return PICO_ERROR_TIMEOUT;
+        }
+        // START, address, NACK, STOP
+        run_until(s_now + wire_us(2 + 9, i2c->baud));
+        return PICO_ERROR_GENERIC;
+    }
+    bus_write(src, len);
+
+    // START, address and data bytes with their ACK bits, STOP
+    run_until(s_now + wire_us(2 + 9 * ((uint64_t)len + 1), i2c->baud));
+    return (int)len;
+}
+
+int i2c_write_blocking(i2c_inst_t* i2c, uint8_t addr, const uint8_t* src, size_t len, bool nostop) {
+    return i2c_write_timeout_us(i2c, addr, src, len, nostop, 0);
+}
+
+i2c_hw_t* i2c_get_hw(i2c_inst_t* i2c) {
+    return &i2c->hw;
+}
+
+uint i2c_get_dreq(i2c_inst_t* i2c, bool is_tx) {
+    (void)i2c;
+    (void)is_tx;
+    return 0;
+}
+
+struct spi_inst {
+    uint baud;
+    spi_hw_t hw;
+};
+
+spi_inst_t spi0_inst;
+spi_inst_t spi1_inst;
+
+uint spi_init(spi_inst_t* spi, uint baudrate) {
+    memset(&spi->hw, 0, sizeof(spi->hw));
+    return spi_set_baudrate(spi, baudrate);
+}
+
+uint spi_set_baudrate(spi_inst_t* spi, uint baudrate) {
+    spi->baud = baudrate;
+    return baudrate;
+}
+
+// Framed like an I2C transaction, with D/C as the control byte
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len) {
+    static uint8_t frame[1 + SSD1306_EMU_WIDTH * SSD1306_EMU_PAGES];
+    uint8_t control = gpio_get(SPI_DC_PIN) ? 0x40 : 0x00;
+    for (size_t off = 0; off < len;) {
+        size_t n = len - off < sizeof(frame) - 1 ? len - off : sizeof(frame) - 1;
+        frame[0] = control;
+        memcpy(&frame[1], src + off, n);
+        bus_write(frame, n + 1);
+        off += n;
+    }
+    run_until(s_now + wire_us(8 * (uint64_t)len, spi->baud));
+    return (int)len;
+}
+
+bool spi_is_busy(const spi_inst_t* spi) {
+    (void)spi;
+    return false;
+}
+
+bool spi_is_readable(const spi_inst_t* spi) {
+    (void)spi;
+    return false;
+}
+
+spi_hw_t* spi_get_hw(spi_inst_t* spi) {
+    return &spi->hw;
+}
+
+uint spi_get_dreq(spi_inst_t* spi, bool is_tx) {
+    (void)spi;
+    (void)is_tx;
+    return 0;
+}
+
+// ---- DMA: none available, transports stay blocking --------------------------
+
+int dma_claim_unused_channel(bool required) {
+    if (required) unsupported("DMA");
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    unsupported("DMA");
+    return (dma_channel_config){ 0 };
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size) {
+    (void)c; (void)size;
+    unsupported("DMA");
+}
+
+void channel_config_set_read_increment(dma_channel_config* c, bool incr) {
+    (void)c; (void)incr;
+    unsupported("DMA");
+}
+
+void channel_config_set_write_increment(dma_channel_config* c, bool incr) {
+    (void)c; (void)incr;
+    unsupported("DMA");
+}
+
+void channel_config_set_dreq(dma_channel_config* c, uint dreq) {
+    (void)c; (void)dreq;
+    unsupported("DMA");
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, uint transfer_count, bool trigger) {
+    (void)channel; (void)config; (void)write_addr; (void)read_addr; (void)transfer_count; (void)trigger;
+    unsupported("DMA");
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void* read_addr, uint32_t transfer_count) {
+    (void)channel; (void)read_addr; (void)transfer_count;
+    unsupported("DMA");
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+    (void)channel; (void)enabled;
+    unsupported("DMA");
+}
+
+bool dma_channel_get_irq0_status(uint channel) {
+    (void)channel;
+    return false;
+}
+
+void dma_channel_acknowledge_irq0(uint channel) {
+    (void)channel;
+}
+
+bool dma_channel_is_busy(uint channel) {
+    (void)channel;
+    return false;
+}
+
+// ---- Multicore: one core only, build with DISPLAY_CORE1=0 -------------------
+
+void multicore_launch_core1(void (*entry)(void)) {
+    (void)entry;
+    unsupported("core 1");
+}
+
+void multicore_reset_core1(void) {
+}
+
+bool multicore_fifo_rvalid(void) {
+    return false;
+}
+
+bool multicore_fifo_wready(void) {
+    return true;
+}
+
+void multicore_fifo_push_blocking(uint32_t data) {
+    (void)data;
+    unsupported("core 1");
+}
+
+uint32_t multicore_fifo_pop_blocking(void) {
+    unsupported("core 1");
+    return 0;
+}
+
+void multicore_fifo_clear_irq(void) {
+}
+
+// ---- Flash: the asset pack region ------------------------------------------
+
+#ifndef HOST_ASSET_PACK
+#define HOST_ASSET_PACK "assets.bin"
+#endif
+
+const uint8_t* host_asset_flash(void) {
+    static uint8_t* region;
+    if (region) return region;
+
+    const char* path = getenv("PICOF_ASSET_PACK");
+    if (!path) path = HOST_ASSET_PACK;
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    // Zero past the pack rather than erased flash's 0xFF: calloc leaves the
+    // untouched pages unmapped, which keeps the load cheap
+    region = calloc(1, ASSET_PACK_SIZE);
+    if (!region) abort();
+    size_t n = fread(region, 1, ASSET_PACK_SIZE, f);
+    fclose(f);
+    (void)n;
+    return region;
+}
+
+// ---- stdio ------------------------------------------------------------------
+
+bool stdio_init_all(void) {
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    return true;
+}
+
+// Nothing arrives on stdin: the harness drives the program through pins
+int getchar_timeout_us(uint32_t timeout_us) {
+    (void)timeout_us;
+    return PICO_ERROR_TIMEOUT;
+}
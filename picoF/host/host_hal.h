@@ -0,0 +1,63 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// Harness side of the host HAL (hal.c), which stands in for the Pico SDK
+// when picoF is built for the host. Time is virtual: it starts at 0 and
+// only moves when the program sleeps, waits or writes to the display bus,
+// or when the harness advances it. Alarm callbacks and GPIO IRQ handlers
+// run on the calling thread as time passes.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306_emu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Current virtual time in microseconds since boot
+uint64_t host_time_us(void);
+
+// Let us of virtual time pass, running every alarm that falls due
+void host_advance_us(uint64_t us);
+
+// Drive an input pin. A level change raises its enabled edge IRQ.
+void host_gpio_set(unsigned gpio, bool level);
+
+// Level last written to an output pin, or the input level
+bool host_gpio_level(unsigned gpio);
+
+// Receives every display bus write as an SSD1306 I2C transaction: control
+// byte (0x00 commands, 0x40 data) then payload, as from the memory
+// transport. SPI writes are framed the same way from the D/C pin. The
+// default sink is host_display(); a NULL sink drops the writes.
+typedef void (*host_bus_sink_t)(void* user, const uint8_t* bytes, size_t n);
+void host_set_bus_sink(host_bus_sink_t sink, void* user);
+
+// Fail the next count I2C writes with error: PICO_ERROR_GENERIC is a NACK
+// on the address (nothing reaches the sink), PICO_ERROR_TIMEOUT uses up
+// the whole timeout. Blocking writes without a timeout only NACK.
+void host_i2c_fail(int error, unsigned count);
+
+// The default sink's panel, with its bus estimated at I2C_BAUD. Virtual
+// time passing also runs its scroll.
+ssd1306_emu_t* host_display(void);
+
+// Called when the program waits with no deadline and no alarm pending, so
+// nothing could ever wake it. Return true once the harness has scheduled
+// something (an alarm, a pin change); false ends the run with exit(0),
+// which is also what happens without a hook.
+typedef bool (*host_idle_hook_t)(void* user);
+void host_set_idle_hook(host_idle_hook_t hook, void* user);
+
+// The asset pack flash region (ASSET_PACK_SIZE bytes, zero past the pack),
+// loaded from $PICOF_ASSET_PACK or the build tree's pack. NULL if neither
+// can be read.
+const uint8_t* host_asset_flash(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,195 @@
+#include "regress.h"
+#include "capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define MAX_REPORTED 5
+
+static regress_opts_t s_opts;
+static bool s_active;
+
+static uint64_t* s_golden;
+static size_t s_golden_count;
+
+static uint64_t* s_hashes;
+static uint64_t* s_costs;
+static size_t s_count, s_cap;
+static uint32_t s_mismatches;
+
+// ---- Cost counter -----------------------------------------------------------
+
+static int s_perf_fd = -1;
+static const char* s_metric = "cpu_ns";
+static uint64_t s_cost_start;
+static uint64_t s_cost;
+
+static void counter_open(void) {
+#ifdef __linux__
+    struct perf_event_attr a;
+    memset(&a, 0, sizeof(a));
+    a.type = PERF_TYPE_HARDWARE;
+    a.size = sizeof(a);
+    a.config = PERF_COUNT_HW_INSTRUCTIONS;
+    a.exclude_kernel = 1;
+    a.exclude_hv = 1;
+    s_perf_fd = (int)syscall(SYS_perf_event_open, &a, 0, -1, -1, 0);
+    if (s_perf_fd >= 0) s_metric = "instructions";
+#endif
+}
+
+static uint64_t counter_read(void) {
+#ifdef __linux__
+    uint64_t v;
+    if (s_perf_fd >= 0 && read(s_perf_fd, &v, sizeof(v)) == sizeof(v)) return v;
+#endif
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// ---- Frames -----------------------------------------------------------------
+
+static uint64_t fnv1a(const uint8_t* p, size_t n) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    while (n--) {
+        h ^= *p++;
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static void load_golden(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) return;
+    char line[64];
+    size_t cap = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') continue;
+        if (s_golden_count == cap) {
+            cap = cap ? cap * 2 : 256;
+            s_golden = realloc(s_golden, cap * sizeof(*s_golden));
+        }
+        s_golden[s_golden_count++] = strtoull(line, NULL, 16);
+    }
+    fclose(f);
+}
+
+void regress_start(const regress_opts_t* o) {
+    s_opts = *o;
+    s_active = o->golden || o->baseline;
+    if (!s_active) return;
+    if (o->golden && !o->record) load_golden(o->golden);
+    counter_open();
+    s_cost_start = counter_read();
+}
+
+void regress_frame_end(void) {
+    if (s_active) s_cost = counter_read() - s_cost_start;
+}
+
+void regress_frame(const uint8_t* img, uint64_t t_us) {
+    if (!s_active) return;
+    if (s_count == s_cap) {
+        s_cap = s_cap ? s_cap * 2 : 1024;
+        s_hashes = realloc(s_hashes, s_cap * sizeof(*s_hashes));
+        s_costs = realloc(s_costs, s_cap * sizeof(*s_costs));
+    }
+    uint64_t h = fnv1a(img, CAPTURE_BYTES);
+    s_hashes[s_count] = h;
+    s_costs[s_count] = s_cost;
+
+    if (s_opts.golden && !s_opts.record) {
+        bool ok = s_count < s_golden_count && s_golden[s_count] == h;
+        if (!ok && s_mismatches++ < MAX_REPORTED) {
+            fprintf(stderr, "frame %lu at %lu ms: %016llx, golden %s\n",
+                    (unsigned long)s_count, (unsigned long)(t_us / 1000), (unsigned long long)h,
+                    s_count < s_golden_count ? "differs" : "has no such frame");
+        }
+    }
+    s_count++;
+    s_cost_start = counter_read();
+}
+
+// ---- Results ----------------------------------------------------------------
+
+static int cmp_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static bool write_golden(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "# FNV-1a of each presented frame (glass, page-major)\n");
+    for (size_t i = 0; i < s_count; i++) fprintf(f, "%016llx\n", (unsigned long long)s_hashes[i]);
+    return fclose(f) == 0;
+}
+
+static int check_baseline(const char* tag, uint64_t mean, uint64_t p95) {
+    const char* path = s_opts.baseline;
+    char metric[32] = "";
+    unsigned long long base_mean = 0, base_p95 = 0;
+    FILE* f = s_opts.record ? NULL : fopen(path, "r");
+    bool have = f && fscanf(f, "%31s %llu %llu", metric, &base_mean, &base_p95) == 3;
+    if (f) fclose(f);
+
+    if (!have) {
+        f = fopen(path, "w");
+        if (!f) {
+            perror(path);
+            return 1;
+        }
+        fprintf(f, "%s %llu %llu\n", s_metric, (unsigned long long)mean, (unsigned long long)p95);
+        fclose(f);
+        printf("%s: cost %s mean %llu p95 %llu per frame, baseline recorded\n",
+               tag, s_metric, (unsigned long long)mean, (unsigned long long)p95);
+        return 0;
+    }
+    if (strcmp(metric, s_metric) != 0) {
+        printf("%s: baseline counts %s, this run %s: not compared\n", tag, metric, s_metric);
+        return 0;
+    }
+
+    uint32_t tol = s_opts.tolerance_pct ? s_opts.tolerance_pct : (s_perf_fd >= 0 ? 5 : 25);
+    long long pct = base_mean ? ((long long)mean - (long long)base_mean) * 100 / (long long)base_mean : 0;
+    bool slower = pct > (long long)tol;
+    printf("%s: cost %s mean %llu p95 %llu per frame, baseline %llu %llu (%+lld%%)%s\n",
+           tag, s_metric, (unsigned long long)mean, (unsigned long long)p95, base_mean, base_p95, pct,
+           slower ? ": SLOWER" : pct < -(long long)tol ? ": faster, consider recording" : "");
+    return slower;
+}
+
+int regress_finish(const char* tag) {
+    if (!s_active) return 0;
+    int status = 0;
+
+    if (s_opts.golden && s_opts.record) {
+        if (!write_golden(s_opts.golden)) {
+            perror(s_opts.golden);
+            status = 1;
+        }
+    } else if (s_opts.golden) {
+        if (s_count != s_golden_count && s_mismatches < MAX_REPORTED)
+            fprintf(stderr, "%lu frames, golden has %lu\n", (unsigned long)s_count, (unsigned long)s_golden_count);
+        if (s_count < s_golden_count) s_mismatches += (uint32_t)(s_golden_count - s_count);
+        printf("%s: %lu frames, %lu differ from %s\n", tag, (unsigned long)s_count,
+               (unsigned long)s_mismatches, s_opts.golden);
+        if (s_mismatches) status = 1;
+    }
+
+    if (s_opts.baseline && s_count) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < s_count; i++) sum += s_costs[i];
+        qsort(s_costs, s_count, sizeof(*s_costs), cmp_u64);
+        uint64_t p95 = s_costs[(s_count * 95) / 100 < s_count ? (s_count * 95) / 100 : s_count - 1];
+        status |= check_baseline(tag, sum / s_count, p95);
+    }
+    return status;
+}
@@ -0,0 +1,42 @@
+#ifndef HOST_REGRESS_H
+#define HOST_REGRESS_H
+
+// Regression checks for simulator runs (see sim.c, regress/):
+// - golden: an FNV-1a hash per presented frame; any difference fails
+// - baseline: mean and p95 render cost per frame, in user-space
+//   instructions where perf counters are available, else thread CPU ns;
+//   a mean more than tolerance above the baseline fails
+// With record set both files are written instead of checked. A missing
+// baseline is recorded rather than failed, as it is specific to the
+// machine.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char* golden;         // Hash file, or NULL
+    const char* baseline;       // Cost file, or NULL
+    bool record;
+    uint32_t tolerance_pct;     // 0 = per-metric default
+} regress_opts_t;
+
+void regress_start(const regress_opts_t* o);
+
+// Call at the start of a present's capture: ends the frame's cost
+void regress_frame_end(void);
+
+// Check (or record) the frame's image, then start the next frame's cost
+void regress_frame(const uint8_t* img, uint64_t t_us);
+
+// Compare or write the files. Returns the process exit status.
+int regress_finish(const char* tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+# Runs every scenario in scenarios.txt through the simulator:
+#   cmake -DSIM=<picoF_sim> -DBASELINE_DIR=<dir> [-DRECORD=ON] -P regress.cmake
+# Frame hashes are checked against golden/<name>.txt (in the source tree)
+# and render cost against <BASELINE_DIR>/<name>.txt (per machine, recorded
+# on first use). RECORD rewrites both.
+set(DIR ${CMAKE_CURRENT_LIST_DIR})
+if(NOT SIM OR NOT BASELINE_DIR)
+    message(FATAL_ERROR "SIM and BASELINE_DIR are required")
+endif()
+file(MAKE_DIRECTORY ${BASELINE_DIR})
+
+set(record_arg)
+if(RECORD)
+    set(record_arg --record)
+endif()
+
+file(STRINGS ${DIR}/scenarios.txt lines)
+set(failed)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[ \t]*(#|$)")
+        continue()
+    endif()
+    separate_arguments(fields UNIX_COMMAND "${line}")
+    list(GET fields 0 name)
+    list(GET fields 1 program)
+    list(GET fields 2 duration)
+    list(GET fields 3 seed)
+    set(args --duration ${duration} --seed ${seed} --quiet
+        --golden ${DIR}/golden/${name}.txt
+        --baseline ${BASELINE_DIR}/${name}.txt)
+    list(LENGTH fields n)
+    if(n GREATER 4)
+        list(GET fields 4 script)
+        list(APPEND args --script ${DIR}/scripts/${script})
+    endif()
+
+    execute_process(COMMAND ${SIM} ${args} ${record_arg} ${program}
+                    RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        list(APPEND failed ${name})
+    endif()
+endforeach()
+
+if(failed)
+    message(FATAL_ERROR "regression: failed: ${failed}")
+endif()
+message(STATUS "regression: all scenarios passed")
@@ -0,0 +1,17 @@
+// Host stand-in for the Pico SDK, see host/hal.c. Clock changes are
+// recorded but only affect the modelled bus speed through the baud rates.
+#ifndef _HARDWARE_CLOCKS_H
+#define _HARDWARE_CLOCKS_H
+
+#include "pico/types.h"
+
+enum clock_index {
+    clk_gpout0 = 0, clk_gpout1, clk_gpout2, clk_gpout3,
+    clk_ref, clk_sys, clk_peri, clk_usb, clk_adc, clk_rtc,
+    CLK_COUNT
+};
+
+uint32_t clock_get_hz(enum clock_index clk_index);
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+
+#endif
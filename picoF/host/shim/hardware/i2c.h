@@ -0,0 +1,38 @@
+// Host stand-in for the Pico SDK, see host/hal.c. Blocking writes go to the
+// harness's display sink and take their wire time in virtual time. There is
+// no DMA, so the driver's async path is never taken.
+#ifndef _HARDWARE_I2C_H
+#define _HARDWARE_I2C_H
+
+#include "pico/types.h"
+#include "pico/error.h"
+
+typedef struct i2c_inst i2c_inst_t;
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+#define I2C_IC_STATUS_TFE_BITS 0x4u
+#define I2C_IC_STATUS_ACTIVITY_BITS 0x1u
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS 0x40u
+#define I2C_IC_DATA_CMD_STOP_BITS 0x200u
+
+typedef struct {
+    volatile uint32_t enable;
+    volatile uint32_t tar;
+    volatile uint32_t data_cmd;
+    volatile uint32_t status;
+    volatile uint32_t raw_intr_stat;
+    volatile uint32_t clr_tx_abrt;
+    volatile uint32_t dma_cr;
+} i2c_hw_t;
+
+uint i2c_init(i2c_inst_t* i2c, uint baudrate);
+uint i2c_set_baudrate(i2c_inst_t* i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t* i2c, uint8_t addr, const uint8_t* src, size_t len, bool nostop);
+int i2c_write_timeout_us(i2c_inst_t* i2c, uint8_t addr, const uint8_t* src, size_t len, bool nostop, uint timeout_us);
+i2c_hw_t* i2c_get_hw(i2c_inst_t* i2c);
+uint i2c_get_dreq(i2c_inst_t* i2c, bool is_tx);
+
+#endif
@@ -0,0 +1,21 @@
+// Host stand-in for the Pico SDK, see host/hal.c. IRQs are kept as flags;
+// only IO_IRQ_BANK0 is ever raised (by host_gpio_set).
+#ifndef _HARDWARE_IRQ_H
+#define _HARDWARE_IRQ_H
+
+#include "pico/types.h"
+
+typedef void (*irq_handler_t)(void);
+
+#define DMA_IRQ_0 11
+#define IO_IRQ_BANK0 13
+#define SIO_IRQ_PROC0 15
+#define SIO_IRQ_PROC1 16
+
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+void irq_set_enabled(uint num, bool enabled);
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+
+#endif
@@ -0,0 +1,29 @@
+// Host stand-in for the Pico SDK, see host/hal.c. Blocking writes go to the
+// harness's display sink (D/C picks command or data) and take their wire
+// time in virtual time.
+#ifndef _HARDWARE_SPI_H
+#define _HARDWARE_SPI_H
+
+#include "pico/types.h"
+
+typedef struct spi_inst spi_inst_t;
+extern spi_inst_t spi0_inst;
+extern spi_inst_t spi1_inst;
+#define spi0 (&spi0_inst)
+#define spi1 (&spi1_inst)
+
+#define SPI_SSPICR_RORIC_BITS 0x1u
+
+typedef struct {
+    volatile uint32_t cr0, cr1, dr, sr, cpsr, imsc, ris, mis, icr, dmacr;
+} spi_hw_t;
+
+uint spi_init(spi_inst_t* spi, uint baudrate);
+uint spi_set_baudrate(spi_inst_t* spi, uint baudrate);
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len);
+bool spi_is_busy(const spi_inst_t* spi);
+bool spi_is_readable(const spi_inst_t* spi);
+spi_hw_t* spi_get_hw(spi_inst_t* spi);
+uint spi_get_dreq(spi_inst_t* spi, bool is_tx);
+
+#endif
@@ -0,0 +1,16 @@
+// Host stand-in for the Pico SDK, see host/hal.c. The host is single
+// threaded and IRQs only run inside shim calls, so there is nothing to mask.
+#ifndef _HARDWARE_SYNC_H
+#define _HARDWARE_SYNC_H
+
+#include "pico/types.h"
+
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t status) { (void)status; }
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+// Latches the event that best_effort_wfe_or_timeout waits for
+void __sev(void);
+void __wfe(void);
+
+#endif
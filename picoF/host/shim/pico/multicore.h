@@ -0,0 +1,16 @@
+// Host stand-in for the Pico SDK, see host/hal.c. There is no second core:
+// build with DISPLAY_CORE1=0. These abort if called.
+#ifndef _PICO_MULTICORE_H
+#define _PICO_MULTICORE_H
+
+#include "pico/types.h"
+
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+void multicore_fifo_clear_irq(void);
+
+#endif
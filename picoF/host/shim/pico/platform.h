@@ -0,0 +1,10 @@
+// Host stand-in for the Pico SDK, see host/hal.c
+#ifndef _PICO_PLATFORM_H
+#define _PICO_PLATFORM_H
+
+#define __isr
+
+// Spin loops on the host only ever wait on hardware the shim doesn't model
+static inline void tight_loop_contents(void) {}
+
+#endif
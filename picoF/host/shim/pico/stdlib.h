@@ -0,0 +1,13 @@
+// Host stand-in for the Pico SDK, see host/hal.c
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+#include "pico/types.h"
+#include "pico/error.h"
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+bool stdio_init_all(void);
+int getchar_timeout_us(uint32_t timeout_us);
+
+#endif
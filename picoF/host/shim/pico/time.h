@@ -0,0 +1,41 @@
+// Host stand-in for the Pico SDK, see host/hal.c. Time is virtual: it only
+// moves when the program sleeps or waits on the bus, so a run is
+// deterministic and as fast as the host can go.
+#ifndef _PICO_TIME_H
+#define _PICO_TIME_H
+
+#include "pico/types.h"
+
+extern const absolute_time_t at_the_end_of_time;
+
+absolute_time_t get_absolute_time(void);
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) { return t + us; }
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) { return t + (uint64_t)ms * 1000; }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) { return (int64_t)(to - from); }
+
+absolute_time_t make_timeout_time_us(uint64_t us);
+absolute_time_t make_timeout_time_ms(uint32_t ms);
+bool time_reached(absolute_time_t t);
+
+void sleep_until(absolute_time_t t);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+
+// Returns true on timeout, false when woken by an event (__sev)
+bool best_effort_wfe_or_timeout(absolute_time_t timeout);
+
+// Alarms run on the thread that advances time, as the timer IRQ would
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void* user_data);
+
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void* user_data, bool fire_if_past);
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void* user_data, bool fire_if_past);
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void* user_data, bool fire_if_past);
+bool cancel_alarm(alarm_id_t alarm_id);
+
+#endif
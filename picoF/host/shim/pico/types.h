@@ -0,0 +1,15 @@
+// Host stand-in for the Pico SDK, see host/hal.c
+#ifndef _PICO_TYPES_H
+#define _PICO_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "pico/platform.h"
+
+typedef unsigned int uint;
+
+// Virtual microseconds since boot
+typedef uint64_t absolute_time_t;
+
+#endif
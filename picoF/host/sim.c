@@ -0,0 +1,299 @@
+// Headless simulator: runs a registered program, or the launcher, on the
+// host HAL in virtual time. Buttons follow an input script and every
+// present can be captured as it appears on the glass.
+//
+//   picoF_sim [options] <program>
+//
+// <program> is a registry name ("Dino", case-insensitive), an index, or
+// "menu" for the launcher. The script has one line per change of button
+// state: "<ms> <LMR>", e.g. "1500 001" presses the right button at 1.5 s.
+// '#' starts a comment.
+#include "host_hal.h"
+#include "capture.h"
+#include "regress.h"
+#include "hardware_init.h"
+#include "gfx.h"
+#include "input.h"
+#include "registry.h"
+#include "perf.h"
+#include "pico/stdlib.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+int picoF_main(void);   // main.c, built as the launcher
+
+typedef struct {
+    uint32_t t_ms;
+    uint8_t buttons;            // Bit i = button i down
+} script_step_t;
+
+static struct {
+    const char* program;
+    const char* script;
+    uint32_t duration_ms;
+    unsigned seed;
+    const char* pbm_dir;
+    const char* png_dir;
+    const char* apng;
+    bool gram;
+    bool quiet;
+    bool overlay;
+    bool perf;
+    regress_opts_t regress;
+} opt = { .duration_ms = 10000, .seed = 1 };
+
+static script_step_t* steps;
+static size_t step_count, step_next;
+
+static uint32_t frames;
+static capture_apng_t apng;
+static struct timespec wall_start;
+
+static void usage(FILE* f) {
+    fprintf(f,
+        "usage: picoF_sim [options] <program>\n"
+        "  <program>        registry name, index, or \"menu\" for the launcher\n"
+        "  --list           list the registered programs\n"
+        "  --script FILE    button script: \"<ms> <LMR>\" per line\n"
+        "  --duration MS    virtual time to run for (default 10000)\n"
+        "  --seed N         srand() seed (default 1)\n"
+        "  --pbm DIR        write every present to DIR/frame_NNNNNN.pbm\n"
+        "  --png DIR        write every present to DIR/frame_NNNNNN.png\n"
+        "  --apng FILE      write the run as an animated PNG\n"
+        "  --gram           capture GRAM instead of the glass\n"
+        "  --golden FILE    check every frame's hash against FILE\n"
+        "  --baseline FILE  check the render cost per frame against FILE\n"
+        "  --tolerance PCT  allowed cost increase (default 5 for instructions, 25 for CPU time)\n"
+        "  --record         write the golden and baseline files instead\n"
+        "  --overlay        draw the perf overlay (fps, frame times)\n"
+        "  --perf           dump the last frames' phase times at the end\n"
+        "  --quiet          no summary\n");
+}
+
+static double wall_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - wall_start.tv_sec) * 1e3 + (now.tv_nsec - wall_start.tv_nsec) / 1e6;
+}
+
+static void finish(const char* why) {
+    capture_apng_close(&apng, host_time_us());
+    int status = regress_finish(opt.program);
+    if (opt.perf) perf_dump();
+    if (!opt.quiet) {
+        double wall = wall_ms();
+        double virt = host_time_us() / 1e3;
+        printf("sim: %s %s: %lu frames in %.0f ms virtual, %.0f ms wall (%.0fx)\n",
+               opt.program, why, (unsigned long)frames, virt, wall, wall > 0 ? virt / wall : 0);
+        ssd1306_emu_report(host_display(), "sim");
+    }
+    fflush(stdout);
+    exit(status);
+}
+
+// ---- Script -----------------------------------------------------------------
+
+static bool load_script(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[256];
+    size_t cap = 0;
+    unsigned n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        n++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = 0;
+        unsigned long ms;
+        char lmr[8];
+        int got = sscanf(line, "%lu %7s", &ms, lmr);
+        if (got <= 0) continue;
+        if (got != 2 || strlen(lmr) != 3 || strspn(lmr, "01") != 3 ||
+            (step_count && ms < steps[step_count - 1].t_ms)) {
+            fprintf(stderr, "%s:%u: expected \"<ms> <LMR>\" in time order\n", path, n);
+            fclose(f);
+            return false;
+        }
+        if (step_count == cap) {
+            cap = cap ? cap * 2 : 64;
+            steps = realloc(steps, cap * sizeof(*steps));
+        }
+        uint8_t b = 0;
+        for (int i = 0; i < 3; i++)
+            if (lmr[i] == '1') b |= (uint8_t)(1u << i);
+        steps[step_count++] = (script_step_t){ (uint32_t)ms, b };
+    }
+    fclose(f);
+    return true;
+}
+
+static int64_t script_alarm(alarm_id_t id, void* user) {
+    (void)id;
+    (void)user;
+    uint64_t now = host_time_us();
+    while (step_next < step_count && (uint64_t)steps[step_next].t_ms * 1000 <= now) {
+        for (int i = 0; i < 3; i++)
+            host_gpio_set(input_button_pin(i), (steps[step_next].buttons >> i) & 1);
+        step_next++;
+    }
+    if (step_next < step_count)
+        add_alarm_at((uint64_t)steps[step_next].t_ms * 1000, script_alarm, NULL, true);
+    return 0;
+}
+
+static int64_t stop_alarm(alarm_id_t id, void* user) {
+    (void)id;
+    (void)user;
+    finish("stopped");
+    return 0;
+}
+
+static bool sim_idle(void* user) {
+    (void)user;
+    finish("idle");
+    return false;
+}
+
+// ---- Capture ----------------------------------------------------------------
+
+static void on_present(void* user) {
+    (void)user;
+    regress_frame_end();
+    ssd1306_emu_t* e = host_display();
+    ssd1306_emu_end_frame(e, NULL);
+
+    uint8_t img[CAPTURE_BYTES] = { 0 };
+    for (int y = 0; y < CAPTURE_H; y++) {
+        for (int x = 0; x < CAPTURE_W; x++) {
+            bool on = opt.gram ? ssd1306_emu_gram_pixel(e, x, y) : ssd1306_emu_pixel(e, x, y);
+            if (on) img[(y / 8) * CAPTURE_W + x] |= (uint8_t)(1u << (y % 8));
+        }
+    }
+
+    char path[512];
+    if (opt.pbm_dir) {
+        snprintf(path, sizeof(path), "%s/frame_%06lu.pbm", opt.pbm_dir, (unsigned long)frames);
+        if (!capture_write_pbm(path, img)) perror(path);
+    }
+    if (opt.png_dir) {
+        snprintf(path, sizeof(path), "%s/frame_%06lu.png", opt.png_dir, (unsigned long)frames);
+        if (!capture_write_png(path, img)) perror(path);
+    }
+    if (apng.f) capture_apng_frame(&apng, img, host_time_us());
+    frames++;
+    regress_frame(img, host_time_us());
+}
+
+// The launcher brings the display up itself, so the callback goes on from
+// an alarm: it runs on the first bus write, once disp has its transport
+static int64_t boot_alarm(alarm_id_t id, void* user) {
+    (void)id;
+    (void)user;
+    if (!disp.io) return 1;
+    ssd1306_set_present_callback(&disp, on_present, NULL);
+    return 0;
+}
+
+// ---- Main -------------------------------------------------------------------
+
+static int find_program(const char* name) {
+    char* end;
+    long idx = strtol(name, &end, 10);
+    if (*name && !*end) return idx >= 0 && idx < (long)registry_count() ? (int)idx : -1;
+    for (uint32_t i = 0; i < registry_count(); i++)
+        if (strcasecmp(registry_entry(i)->name, name) == 0) return (int)i;
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!strcmp(a, "--list")) {
+            for (uint32_t k = 0; k < registry_count(); k++) printf("%lu %s\n", (unsigned long)k, registry_entry(k)->name);
+            return 0;
+        } else if (!strcmp(a, "--gram")) {
+            opt.gram = true;
+        } else if (!strcmp(a, "--quiet")) {
+            opt.quiet = true;
+        } else if (!strcmp(a, "--overlay")) {
+            opt.overlay = true;
+        } else if (!strcmp(a, "--perf")) {
+            opt.perf = true;
+        } else if (!strcmp(a, "--record")) {
+            opt.regress.record = true;
+        } else if (!strcmp(a, "--help") || !strcmp(a, "-h")) {
+            usage(stdout);
+            return 0;
+        } else if (a[0] == '-' && a[1] == '-' && !v) {
+            fprintf(stderr, "%s needs a value\n", a);
+            return 2;
+        } else if (!strcmp(a, "--script")) {
+            opt.script = argv[++i];
+        } else if (!strcmp(a, "--duration")) {
+            opt.duration_ms = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(a, "--seed")) {
+            opt.seed = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(a, "--pbm")) {
+            opt.pbm_dir = argv[++i];
+        } else if (!strcmp(a, "--png")) {
+            opt.png_dir = argv[++i];
+        } else if (!strcmp(a, "--apng")) {
+            opt.apng = argv[++i];
+        } else if (!strcmp(a, "--golden")) {
+            opt.regress.golden = argv[++i];
+        } else if (!strcmp(a, "--baseline")) {
+            opt.regress.baseline = argv[++i];
+        } else if (!strcmp(a, "--tolerance")) {
+            opt.regress.tolerance_pct = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (a[0] != '-' && !opt.program) {
+            opt.program = a;
+        } else {
+            usage(stderr);
+            return 2;
+        }
+    }
+    if (!opt.program) {
+        usage(stderr);
+        return 2;
+    }
+
+    bool menu = strcasecmp(opt.program, "menu") == 0;
+    int idx = menu ? -1 : find_program(opt.program);
+    if (!menu && idx < 0) {
+        fprintf(stderr, "no program \"%s\" (see --list)\n", opt.program);
+        return 2;
+    }
+    if (opt.script && !load_script(opt.script)) return 2;
+    if (opt.apng && !capture_apng_open(&apng, opt.apng)) {
+        perror(opt.apng);
+        return 2;
+    }
+
+    srand(opt.seed);
+    perf_overlay_set(opt.overlay);
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    regress_start(&opt.regress);
+    host_set_idle_hook(sim_idle, NULL);
+    add_alarm_at(0, boot_alarm, NULL, true);
+    if (step_count) add_alarm_at((uint64_t)steps[0].t_ms * 1000, script_alarm, NULL, true);
+    add_alarm_in_ms(opt.duration_ms, stop_alarm, NULL, true);
+
+    if (menu) {
+        picoF_main();
+    } else {
+        stdio_init_all();
+        hardware_init();
+        gfx_init(&disp);
+        input_init();
+        registry_launch((uint32_t)idx);
+    }
+    finish("exited");
+    return 0;
+}
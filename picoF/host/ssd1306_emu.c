@@ -0,0 +1,316 @@
+#include "ssd1306_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+void ssd1306_emu_init(ssd1306_emu_t* e, uint32_t i2c_hz) {
+    memset(e, 0, sizeof(*e));
+    e->mode = 2;
+    e->col1 = SSD1306_EMU_WIDTH - 1;
+    e->page1 = SSD1306_EMU_PAGES - 1;
+    e->com_pins = 0x12;
+    e->mux = SSD1306_EMU_HEIGHT - 1;
+    e->contrast = 0x7F;
+    e->clock_div = 0x80;
+    e->precharge = 0x22;
+    e->scroll_rows = SSD1306_EMU_HEIGHT;
+    e->i2c_hz = i2c_hz;
+}
+
+// ---- Commands ---------------------------------------------------------------
+
+// Bytes that follow each command byte
+static uint8_t arg_count(uint8_t c) {
+    switch (c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+// Scroll step interval (0x26-0x2A argument C) in panel frames
+static const uint16_t scroll_intervals[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+static void setup_scroll(ssd1306_emu_t* e, const uint8_t* c) {
+    // Setting up a scroll while one runs is undefined; the panel stops it
+    e->scrolling = false;
+    e->scroll_dx = (c[0] == 0x26 || c[0] == 0x29) ? 1 : -1;
+    e->scroll_page0 = c[2] & 7;
+    e->scroll_frames = scroll_intervals[c[3] & 7];
+    e->scroll_page1 = c[4] & 7;
+    e->scroll_dy = (c[0] == 0x29 || c[0] == 0x2A) ? c[5] & 0x3F : 0;
+}
+
+static void run_command(ssd1306_emu_t* e) {
+    const uint8_t* c = e->cmd;
+    bool window_mode = e->mode != 2;
+
+    switch (c[0]) {
+    case 0x20:
+        e->mode = c[1] & 3;
+        if (e->mode == 3) {
+            e->mode = 2;
+            e->ignored++;
+        }
+        return;
+    case 0x21:
+        if (!window_mode) break;
+        e->col0 = c[1] & 0x7F;
+        e->col1 = c[2] & 0x7F;
+        e->col = e->col0;
+        return;
+    case 0x22:
+        if (!window_mode) break;
+        e->page0 = c[1] & 7;
+        e->page1 = c[2] & 7;
+        e->page = e->page0;
+        return;
+    case 0x26: case 0x27: case 0x29: case 0x2A:
+        setup_scroll(e, c);
+        return;
+    case 0x2E:
+        e->scrolling = false;
+        return;
+    case 0x2F:
+        if (!e->scroll_frames) break;
+        e->scrolling = true;
+        e->scroll_phase = 0;
+        e->panel_ns = 0;
+        return;
+    case 0x81:
+        e->contrast = c[1];
+        return;
+    case 0x8D:
+        e->charge_pump = c[1] & 0x04;
+        return;
+    case 0xA0: case 0xA1:
+        e->seg_remap = c[0] & 1;
+        return;
+    case 0xA3:
+        e->scroll_top = c[1] & 0x3F;
+        e->scroll_rows = c[2] & 0x7F;
+        return;
+    case 0xA4: case 0xA5:
+        e->entire_on = c[0] & 1;
+        return;
+    case 0xA6: case 0xA7:
+        e->inverse = c[0] & 1;
+        return;
+    case 0xA8:
+        if ((c[1] & 0x3F) < 15) break;
+        e->mux = c[1] & 0x3F;
+        return;
+    case 0xAE: case 0xAF:
+        e->on = c[0] & 1;
+        return;
+    case 0xD3:
+        e->offset = c[1] & 0x3F;
+        return;
+    case 0xD5:
+        e->clock_div = c[1];
+        return;
+    case 0xD9:
+        e->precharge = c[1];
+        return;
+    case 0xDA:
+        e->com_pins = c[1];
+        return;
+    case 0xDB: case 0xE3:
+        return;
+    default:
+        if (c[0] >= 0x40 && c[0] <= 0x7F) {
+            e->start_line = c[0] & 0x3F;
+            return;
+        }
+        if (c[0] >= 0xC0 && c[0] <= 0xCF) {
+            e->com_remap = c[0] & 0x08;
+            return;
+        }
+        // Page addressing pointers
+        if (window_mode) break;
+        if (c[0] <= 0x0F) {
+            e->col = (e->col & 0x70) | c[0];
+            return;
+        }
+        if (c[0] <= 0x17) {
+            e->col = (uint8_t)(((c[0] & 0x07) << 4) | (e->col & 0x0F));
+            return;
+        }
+        if (c[0] >= 0xB0 && c[0] <= 0xB7) {
+            e->page = c[0] & 7;
+            return;
+        }
+        break;
+    }
+    e->ignored++;
+}
+
+static void command_byte(ssd1306_emu_t* e, uint8_t b) {
+    e->frame.command_bytes++;
+    e->total.command_bytes++;
+    if (e->cmd_len == 0) e->cmd_need = (uint8_t)(1 + arg_count(b));
+    e->cmd[e->cmd_len++] = b;
+    if (e->cmd_len < e->cmd_need) return;
+    run_command(e);
+    e->cmd_len = 0;
+}
+
+// ---- GRAM writes ------------------------------------------------------------
+
+static void data_byte(ssd1306_emu_t* e, uint8_t b) {
+    e->frame.data_bytes++;
+    e->total.data_bytes++;
+    e->gram[e->page & 7][e->col & 0x7F] = b;
+
+    switch (e->mode) {
+    case 0: // Horizontal: across the window, then down a page
+        if (e->col++ >= e->col1) {
+            e->col = e->col0;
+            e->page = e->page >= e->page1 ? e->page0 : e->page + 1;
+        }
+        break;
+    case 1: // Vertical: down the window, then across a column
+        if (e->page++ >= e->page1) {
+            e->page = e->page0;
+            e->col = e->col >= e->col1 ? e->col0 : e->col + 1;
+        }
+        break;
+    default: // Page: along the page, back to column 0 at the end
+        e->col = (e->col + 1) & 0x7F;
+        break;
+    }
+}
+
+void ssd1306_emu_write(void* user, const uint8_t* bytes, size_t n) {
+    ssd1306_emu_t* e = user;
+    if (!n) return;
+
+    // START, address and every byte with its ACK, STOP
+    uint64_t bits = 2 + 9 * ((uint64_t)n + 1);
+    uint64_t ns = e->i2c_hz ? bits * 1000000000u / e->i2c_hz : 0;
+    e->frame.transactions++;
+    e->frame.bytes += (uint32_t)n;
+    e->frame.bus_ns += ns;
+    e->total.transactions++;
+    e->total.bytes += (uint32_t)n;
+    e->total.bus_ns += ns;
+
+    // Each control byte picks commands or data (D/C#). With Co set only the
+    // next byte follows it; with Co clear the rest of the transaction does.
+    size_t i = 0;
+    while (i < n) {
+        uint8_t control = bytes[i++];
+        bool data = control & 0x40;
+        size_t end = (control & 0x80) && i < n ? i + 1 : n;
+        for (; i < end; i++) {
+            if (data)
+                data_byte(e, bytes[i]);
+            else
+                command_byte(e, bytes[i]);
+        }
+    }
+}
+
+void ssd1306_emu_end_frame(ssd1306_emu_t* e, ssd1306_emu_stats_t* out) {
+    if (out) *out = e->frame;
+    memset(&e->frame, 0, sizeof(e->frame));
+    e->frames++;
+}
+
+// ---- Panel timing and scrolling ---------------------------------------------
+
+uint32_t ssd1306_emu_frame_mhz(const ssd1306_emu_t* e) {
+    // Fosc rises with 0xD5's upper nibble, ~370 kHz at the reset value 8.
+    // A row takes phase 1 + phase 2 + 50 DCLKs (0xD9, 0 is invalid -> 2).
+    uint32_t fosc_hz = 300000 + 9000 * (e->clock_div >> 4);
+    uint32_t div = (e->clock_div & 0x0F) + 1;
+    uint32_t p1 = e->precharge & 0x0F ? e->precharge & 0x0F : 2;
+    uint32_t p2 = e->precharge >> 4 ? e->precharge >> 4 : 2;
+    uint32_t clocks = div * (p1 + p2 + 50) * (e->mux + 1u);
+    return (uint32_t)((uint64_t)fosc_hz * 1000 / clocks);
+}
+
+// Horizontal scrolling moves GRAM itself; it stays moved after 0x2E
+static void scroll_columns(ssd1306_emu_t* e, uint32_t steps) {
+    uint32_t k = steps % SSD1306_EMU_WIDTH;
+    if (!k || !e->scroll_dx) return;
+    if (e->scroll_dx < 0) k = SSD1306_EMU_WIDTH - k;
+    uint8_t row[SSD1306_EMU_WIDTH];
+    for (int page = e->scroll_page0; page <= e->scroll_page1; page++) {
+        for (int x = 0; x < SSD1306_EMU_WIDTH; x++)
+            row[(x + k) % SSD1306_EMU_WIDTH] = e->gram[page][x];
+        memcpy(e->gram[page], row, sizeof(row));
+    }
+}
+
+void ssd1306_emu_advance_us(ssd1306_emu_t* e, uint64_t us) {
+    if (!e->scrolling) return;
+    uint64_t frame_ns = 1000000000000ull / ssd1306_emu_frame_mhz(e);
+    e->panel_ns += us * 1000;
+    uint64_t frames = e->panel_ns / frame_ns;
+    e->panel_ns -= frames * frame_ns;
+
+    uint64_t phase = e->scroll_phase + frames;
+    uint64_t steps = phase / e->scroll_frames;
+    e->scroll_phase = (uint32_t)(phase % e->scroll_frames);
+    if (!steps) return;
+
+    scroll_columns(e, (uint32_t)(steps % SSD1306_EMU_WIDTH));
+    if (e->scroll_dy && e->scroll_rows)
+        e->scroll_y = (uint8_t)((e->scroll_y + steps * e->scroll_dy) % e->scroll_rows);
+}
+
+// ---- Glass ------------------------------------------------------------------
+
+// Glass coordinates are those of the usual 128x64 module: mounted so that
+// segment remap (0xA1) and remapped COM scan (0xC8) with alternative COM
+// pins (0xDA 0x12) show GRAM upright.
+bool ssd1306_emu_pixel(const ssd1306_emu_t* e, int x, int y) {
+    if (x < 0 || x >= SSD1306_EMU_WIDTH || y < 0 || y >= SSD1306_EMU_HEIGHT) return false;
+    if (!e->on || !e->charge_pump) return false;
+    if (e->entire_on) return true;
+
+    // Row y is wired to COM pin 63 - y; sequential COM pins (0xDA bit 4
+    // clear) take the even rows from the first half of the COMs
+    int pin = SSD1306_EMU_HEIGHT - 1 - y;
+    int com = (e->com_pins & 0x10) ? pin : (pin & 1) ? 32 + pin / 2 : pin / 2;
+    if (e->com_pins & 0x20) com ^= 32;
+
+    // Only mux + 1 COMs are driven; the scan runs from COM0 or COM[N-1]
+    int n = e->mux + 1;
+    if (com >= n) return false;
+    int r = e->com_remap ? n - 1 - com : com;
+
+    if (e->scrolling && e->scroll_dy && r >= e->scroll_top && r < e->scroll_top + e->scroll_rows)
+        r = e->scroll_top + (r - e->scroll_top + e->scroll_y) % e->scroll_rows;
+    int ram_row = (r + e->start_line + e->offset) & (SSD1306_EMU_HEIGHT - 1);
+
+    // SEG0 is at the right edge
+    int seg = SSD1306_EMU_WIDTH - 1 - x;
+    int col = e->seg_remap ? SSD1306_EMU_WIDTH - 1 - seg : seg;
+
+    bool lit = ssd1306_emu_gram_pixel(e, col, ram_row);
+    return lit != e->inverse;
+}
+
+// ---- Report -----------------------------------------------------------------
+
+void ssd1306_emu_report(const ssd1306_emu_t* e, const char* tag) {
+    const ssd1306_emu_stats_t* t = &e->total;
+    uint32_t frames = e->frames ? e->frames : 1;
+    printf("%s: %lu frames, %lu transactions, %lu B (%lu data, %lu command), "
+           "bus %lu us at %lu kHz; per frame %lu transactions, %lu B, %lu us\n",
+           tag, (unsigned long)e->frames, (unsigned long)t->transactions,
+           (unsigned long)t->bytes, (unsigned long)t->data_bytes, (unsigned long)t->command_bytes,
+           (unsigned long)(t->bus_ns / 1000), (unsigned long)(e->i2c_hz / 1000),
+           (unsigned long)(t->transactions / frames), (unsigned long)(t->bytes / frames),
+           (unsigned long)(t->bus_ns / 1000 / frames));
+    if (e->ignored) printf("%s: %lu commands ignored\n", tag, (unsigned long)e->ignored);
+}
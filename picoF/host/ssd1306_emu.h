@@ -0,0 +1,117 @@
+#ifndef SSD1306_EMU_H
+#define SSD1306_EMU_H
+
+// SSD1306 emulator for the host build. Consumes the bytes the panel would
+// receive over I2C, one transaction at a time (control byte first, as from
+// the memory transport or host_hal.h's bus sink), and keeps the controller
+// state: GRAM, the three addressing modes and their pointers, segment/COM
+// remap, multiplex ratio, display offset and start line, contrast,
+// inversion, and horizontal/vertical scrolling.
+//
+// It also accounts for the traffic: transactions, bytes and the time they
+// take on an I2C bus at i2c_hz, in total and per frame (the harness marks
+// frame ends, e.g. from the present callback).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SSD1306_EMU_WIDTH  128
+#define SSD1306_EMU_HEIGHT 64
+#define SSD1306_EMU_PAGES  (SSD1306_EMU_HEIGHT / 8)
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;             // After the address byte, control bytes included
+    uint32_t data_bytes;        // Written to GRAM
+    uint32_t command_bytes;     // Commands and their arguments
+    uint64_t bus_ns;            // Estimated wire time at i2c_hz
+} ssd1306_emu_stats_t;
+
+typedef struct {
+    uint8_t gram[SSD1306_EMU_PAGES][SSD1306_EMU_WIDTH];
+
+    // Addressing
+    uint8_t mode;               // 0 horizontal, 1 vertical, 2 page
+    uint8_t col0, col1;         // Column window (0x21)
+    uint8_t page0, page1;       // Page window (0x22)
+    uint8_t col, page;          // GRAM pointer
+
+    // Display
+    bool on;                    // 0xAE/0xAF
+    bool charge_pump;           // 0x8D; the panel stays dark without it
+    bool inverse;               // 0xA6/0xA7
+    bool entire_on;             // 0xA4/0xA5
+    bool seg_remap;             // 0xA0/0xA1: column 127 on SEG0
+    bool com_remap;             // 0xC0/0xC8: scan from COM[N-1] to COM0
+    uint8_t com_pins;           // 0xDA argument
+    uint8_t mux;                // 0xA8: multiplex ratio - 1
+    uint8_t offset;             // 0xD3: vertical shift by COM
+    uint8_t start_line;         // 0x40-0x7F
+    uint8_t contrast;           // 0x81
+    uint8_t clock_div;          // 0xD5 argument
+    uint8_t precharge;          // 0xD9 argument
+
+    // Scrolling (0x26/0x27/0x29/0x2A, 0xA3, 0x2E/0x2F)
+    bool scrolling;
+    int8_t scroll_dx;           // -1 left, 0 none, +1 right
+    uint8_t scroll_dy;          // Rows per step for vertical scrolling
+    uint8_t scroll_page0, scroll_page1;
+    uint16_t scroll_frames;     // Panel frames per step
+    uint8_t scroll_top, scroll_rows;    // Vertical scroll area (0xA3)
+    uint8_t scroll_y;           // Current vertical scroll offset
+    uint32_t scroll_phase;      // Panel frames since the last step
+    uint64_t panel_ns;          // Time not yet turned into panel frames
+
+    // Command parser; arguments may arrive in later transactions
+    uint8_t cmd[8];
+    uint8_t cmd_len, cmd_need;
+
+    // Traffic
+    uint32_t i2c_hz;
+    uint32_t frames;
+    ssd1306_emu_stats_t total;
+    ssd1306_emu_stats_t frame;
+    uint32_t ignored;           // Unknown commands, or not valid in the current mode
+} ssd1306_emu_t;
+
+// Reset state (blank GRAM, page addressing, display off) with the bus
+// estimated at i2c_hz
+void ssd1306_emu_init(ssd1306_emu_t* e, uint32_t i2c_hz);
+
+// Feed one I2C transaction (control byte first). Matches the memory
+// transport's sink, with e as user.
+void ssd1306_emu_write(void* e, const uint8_t* bytes, size_t n);
+
+// Close the current frame: its traffic goes to out (if not NULL) and the
+// per-frame counters restart
+void ssd1306_emu_end_frame(ssd1306_emu_t* e, ssd1306_emu_stats_t* out);
+
+// Let us of panel time pass, which is what moves an active scroll
+void ssd1306_emu_advance_us(ssd1306_emu_t* e, uint64_t us);
+
+// Panel refresh rate in mHz from the oscillator, precharge and multiplex
+// settings (typical Fosc, so an estimate)
+uint32_t ssd1306_emu_frame_mhz(const ssd1306_emu_t* e);
+
+// Pixel at (x, y) of the glass, after remap, offset, start line, COM pin
+// configuration, inversion and power state
+bool ssd1306_emu_pixel(const ssd1306_emu_t* e, int x, int y);
+
+// Pixel at (x, y) of GRAM, page-major as the driver writes it
+static inline bool ssd1306_emu_gram_pixel(const ssd1306_emu_t* e, int x, int y) {
+    return (e->gram[y / 8][x] >> (y % 8)) & 1;
+}
+
+// Print the traffic totals and per-frame averages
+void ssd1306_emu_report(const ssd1306_emu_t* e, const char* tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
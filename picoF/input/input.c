@@ -1,6 +1,9 @@
 #include "input.h"
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "pico/time.h"
+#include "perf.h"
 #include <string.h>
 
 #define BTN_COUNT 3
@@ -12,16 +15,29 @@
 #define BTN_DEBOUNCE_MS 20
 #define BTN_HELD_MS     400
 
+#define BTN_MASK ((1u << BTN0_PIN) | (1u << BTN1_PIN) | (1u << BTN2_PIN))
+
+// IRQ-side state. The first edge of a bounce is taken at once (so a press
+// is seen within microseconds), then edges are ignored for BTN_DEBOUNCE_MS;
+// the settle alarm re-samples the pin at the end in case it changed again.
 typedef struct {
-    bool raw;
-    bool debounced;
-    bool prev;
-    uint32_t last_ms;
-    uint32_t since_ms;
+    volatile bool level;    // Debounced level
+    alarm_id_t settle;      // Lockout running while non-zero
+    alarm_id_t held;        // Pending held event while non-zero
 } btn_t;
 
 static btn_t btns[BTN_COUNT];
 
+// Event queue: single producer (GPIO and timer IRQs, which don't preempt
+// each other at the default priority), single consumer (thread code)
+#define QUEUE_LEN 32   // Power of two
+static InputEvent queue[QUEUE_LEN];
+static volatile uint8_t q_head;
+static volatile uint8_t q_tail;
+static volatile uint32_t q_dropped;
+
+static InputSnapshot snap;
+
 // Mapping table: physical index -> logical action per program
 static const Action mapping[PROGRAM_MAX_][BTN_COUNT] = {
     [PROGRAM_MENU]     = { ACTION_MENU_UP,     ACTION_MENU_SELECT, ACTION_MENU_DOWN },
@@ -30,11 +46,6 @@ static const Action mapping[PROGRAM_MAX_][BTN_COUNT] = {
     [PROGRAM_ANIMATION]= { ACTION_NONE,        ACTION_NONE,        ACTION_NONE },
 };
 
-// Stub — replace with your launcher’s getter
-ProgramID current_program_id(void) {
-    return PROGRAM_MENU;
-}
-
 static inline uint btn_pin(int i) {
     switch (i) {
         case 0: return BTN0_PIN;
@@ -63,53 +74,168 @@ static inline void init_button_pin(uint btn_pin) {
 #endif
 }
 
+// ---- IRQ side ---------------------------------------------------------------
+
+static void push_event(int i, InputEventType type, uint32_t t_us) {
+    uint8_t next = (q_head + 1) & (QUEUE_LEN - 1);
+    if (next == q_tail) {
+        q_dropped++;
+        return;
+    }
+    queue[q_head] = (InputEvent){ t_us, (uint8_t)i, (uint8_t)type };
+    __dmb();
+    q_head = next;
+    __sev();   // Wake input_wait() even if this landed just before its WFE
+}
+
+static int64_t held_alarm(alarm_id_t id, void* user) {
+    (void)id;
+    int i = (int)(intptr_t)user;
+    btns[i].held = 0;
+    if (btns[i].level) push_event(i, INPUT_HELD, time_us_32());
+    return 0;
+}
+
+static void accept_level(int i, bool level, uint32_t t_us) {
+    btn_t* b = &btns[i];
+    b->level = level;
+    push_event(i, level ? INPUT_PRESS : INPUT_RELEASE, t_us);
+
+    if (b->held) {
+        cancel_alarm(b->held);
+        b->held = 0;
+    }
+    if (level) {
+        alarm_id_t id = add_alarm_in_ms(BTN_HELD_MS, held_alarm, (void*)(intptr_t)i, true);
+        b->held = id > 0 ? id : 0;
+    }
+}
+
+static int64_t settle_alarm(alarm_id_t id, void* user) {
+    (void)id;
+    int i = (int)(intptr_t)user;
+    bool r = read_active(i);
+    if (r == btns[i].level) {
+        btns[i].settle = 0;
+        return 0;
+    }
+    // Changed during the lockout: take it and lock out again
+    accept_level(i, r, time_us_32());
+    return -(int64_t)BTN_DEBOUNCE_MS * 1000;
+}
+
+static void button_edge(int i, uint32_t t_us) {
+    btn_t* b = &btns[i];
+    if (b->settle) return;
+    bool r = read_active(i);
+    if (r == b->level) return;
+
+    accept_level(i, r, t_us);
+    alarm_id_t id = add_alarm_in_ms(BTN_DEBOUNCE_MS, settle_alarm, (void*)(intptr_t)i, true);
+    b->settle = id > 0 ? id : 0;
+}
+
+static void __isr buttons_irq(void) {
+    uint32_t now = time_us_32();
+    for (int i = 0; i < BTN_COUNT; i++) {
+        uint32_t events = gpio_get_irq_event_mask(btn_pin(i));
+        if (!events) continue;
+        gpio_acknowledge_irq(btn_pin(i), events);
+        button_edge(i, now);
+    }
+}
+
+// ---- Thread side ------------------------------------------------------------
+
+unsigned input_button_pin(int idx) {
+    return btn_pin(idx);
+}
+
 void input_init(void) {
     init_button_pin(BTN0_PIN);
     init_button_pin(BTN1_PIN);
     init_button_pin(BTN2_PIN);
 
-    uint32_t now = to_ms_since_boot(get_absolute_time());
     memset(btns, 0, sizeof(btns));
+    memset(&snap, 0, sizeof(snap));
+    q_head = q_tail = 0;
+    q_dropped = 0;
     for (int i = 0; i < BTN_COUNT; i++) {
-        btns[i].raw = read_active(i);
-        btns[i].debounced = btns[i].raw;
-        btns[i].prev = btns[i].debounced;
-        btns[i].last_ms = now;
-        btns[i].since_ms = now;
+        btns[i].level = read_active(i);
+        if (!btns[i].level) continue;
+        snap.down |= 1u << i;
+        alarm_id_t id = add_alarm_in_ms(BTN_HELD_MS, held_alarm, (void*)(intptr_t)i, true);
+        btns[i].held = id > 0 ? id : 0;
     }
+
+    gpio_add_raw_irq_handler_masked(BTN_MASK, buttons_irq);
+    for (int i = 0; i < BTN_COUNT; i++)
+        gpio_set_irq_enabled(btn_pin(i), GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+bool input_pending(void) {
+    return q_head != q_tail;
+}
+
+bool input_wait(absolute_time_t deadline) {
+    while (!input_pending()) {
+        if (best_effort_wfe_or_timeout(deadline)) return input_pending();
+    }
+    return true;
+}
+
+bool input_poll_event(InputEvent* ev) {
+    uint8_t tail = q_tail;
+    if (tail == q_head) return false;
+    __dmb();
+    *ev = queue[tail];
+    q_tail = (tail + 1) & (QUEUE_LEN - 1);
+    return true;
 }
 
 void input_update(uint32_t now_ms) {
-    for (int i = 0; i < BTN_COUNT; i++) {
-        bool r = read_active(i);
-        if (r != btns[i].raw) {
-            btns[i].raw = r;
-            btns[i].last_ms = now_ms;
-        }
-        if (btns[i].debounced != btns[i].raw) {
-            if ((now_ms - btns[i].last_ms) >= BTN_DEBOUNCE_MS) {
-                btns[i].prev = btns[i].debounced;
-                btns[i].debounced = btns[i].raw;
-                btns[i].since_ms = now_ms;
-            }
-        } else {
-            btns[i].prev = btns[i].debounced;
+    perf_begin(PERF_INPUT);
+    snap.now_ms = now_ms;
+    snap.pressed = 0;
+    snap.released = 0;
+    snap.event_count = 0;
+
+    InputEvent ev;
+    while (input_poll_event(&ev)) {
+        uint8_t bit = (uint8_t)(1u << ev.button);
+        switch (ev.type) {
+        case INPUT_PRESS:
+            snap.down |= bit;
+            snap.pressed |= bit;
+            break;
+        case INPUT_RELEASE:
+            snap.down &= (uint8_t)~bit;
+            snap.held &= (uint8_t)~bit;
+            snap.released |= bit;
+            break;
+        case INPUT_HELD:
+            if (snap.down & bit) snap.held |= bit;
+            break;
         }
+        if (snap.event_count < INPUT_FRAME_EVENTS) snap.events[snap.event_count++] = ev;
     }
+    perf_end(PERF_INPUT);
+}
+
+const InputSnapshot* input_snapshot(void) {
+    return &snap;
 }
 
-// Physical queries
+// Physical queries (answered from the current snapshot)
 bool input_pressed(int idx) {
-    return (idx >= 0 && idx < BTN_COUNT) && (btns[idx].debounced && !btns[idx].prev);
+    return (idx >= 0 && idx < BTN_COUNT) && (snap.pressed & (1u << idx));
 }
 bool input_released(int idx) {
-    return (idx >= 0 && idx < BTN_COUNT) && (!btns[idx].debounced && btns[idx].prev);
+    return (idx >= 0 && idx < BTN_COUNT) && (snap.released & (1u << idx));
 }
 bool input_held(int idx) {
-    if (idx < 0 || idx >= BTN_COUNT) return false;
-    if (!btns[idx].debounced) return false;
-    uint32_t now = to_ms_since_boot(get_absolute_time());
-    return (now - btns[idx].since_ms) >= BTN_HELD_MS;
+    return (idx >= 0 && idx < BTN_COUNT) && (snap.held & (1u << idx));
 }
 
 // Logical queries
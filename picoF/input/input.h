@@ -1,6 +1,7 @@
 #pragma once
 #include <stdbool.h>
 #include <stdint.h>
+#include "pico/time.h"
 
 // Logical actions
 typedef enum {
@@ -25,12 +26,52 @@ typedef enum {
     PROGRAM_MAX_
 } ProgramID;
 
-// Provided by your launcher (stub for now)
+// Provided by the launcher (registry.c)
 ProgramID current_program_id(void);
 
-// Init/update
+// Button events, timestamped in the GPIO/alarm IRQ that produced them
+typedef enum {
+    INPUT_PRESS = 0,
+    INPUT_RELEASE,
+    INPUT_HELD,         // Still down BTN_HELD_MS after the press
+} InputEventType;
+
+typedef struct {
+    uint32_t t_us;      // time_us_32() at the debounced edge
+    uint8_t button;     // Physical index
+    uint8_t type;       // InputEventType
+} InputEvent;
+
+// Events kept per snapshot; extra ones still update the state bits
+#define INPUT_FRAME_EVENTS 8
+
+// Button state for one frame, built by input_update(). Bit i = button i.
+typedef struct {
+    uint32_t now_ms;    // As passed to input_update()
+    uint8_t down;       // Debounced level
+    uint8_t pressed;    // Went down since the last update
+    uint8_t released;   // Went up since the last update
+    uint8_t held;       // Down for at least BTN_HELD_MS
+    uint8_t event_count;
+    InputEvent events[INPUT_FRAME_EVENTS];
+} InputSnapshot;
+
+// Init/update. Buttons are sampled by edge IRQs and debounced there;
+// input_update() drains the event queue into the frame's snapshot.
 void input_init(void);
 void input_update(uint32_t now_ms);
+const InputSnapshot* input_snapshot(void);
+
+// Raw event queue, for code that does not use input_update()
+bool input_poll_event(InputEvent* ev);
+bool input_pending(void);
+
+// Sleep (WFE) until an event is queued or the deadline passes. Returns
+// true if an event is pending.
+bool input_wait(absolute_time_t deadline);
+
+// GPIO of physical button idx (0 = left, 1 = middle, 2 = right)
+unsigned input_button_pin(int idx);
 
 // Physical button queries
 bool input_pressed(int idx);
@@ -40,8 +40,12 @@ int main(void) {
     gfx_init(&disp);
     input_init();
     draw_menu();
+    hardware_set_idle(true);
 
+    // Nothing changes on the menu without a button, so sleep until the
+    // input IRQs queue an event
     while (true) {
+        input_wait(at_the_end_of_time);
         uint32_t now = to_ms_since_boot(get_absolute_time());
         input_update(now);
 
@@ -54,8 +58,10 @@ int main(void) {
             draw_menu();
         }
         if (action_pressed(ACTION_MENU_SELECT)) {
-            registry_set_active_program((ProgramID)selected);
-            registry_entry(selected)->run();
+            hardware_set_idle(false);
+            registry_launch(selected);
+            hardware_set_idle(true);
+            registry_set_active_program(PROGRAM_MENU);
             draw_menu();
         }
 
@@ -0,0 +1,114 @@
+#include "perf.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "gfx.h"
+
+// Open phases, innermost last
+#define PERF_DEPTH 4
+
+static uint8_t s_stack[PERF_DEPTH];
+static int s_depth;
+static uint32_t s_mark_us;              // Start of the slice being timed
+static uint32_t s_acc[PERF_PHASES];     // Current frame so far
+static uint32_t s_frame_start;
+static uint16_t s_note;
+
+static perf_frame_t s_ring[PERF_RING_FRAMES];
+static uint32_t s_seq;                  // Frames closed since boot
+static bool s_overlay = PERF_OVERLAY;
+
+// Charge the slice up to now to the innermost open phase
+static void charge(uint32_t now) {
+    if (s_depth) s_acc[s_stack[(s_depth < PERF_DEPTH ? s_depth : PERF_DEPTH) - 1]] += now - s_mark_us;
+    s_mark_us = now;
+}
+
+void perf_begin(perf_phase_t p) {
+    charge(time_us_32());
+    if (s_depth < PERF_DEPTH) s_stack[s_depth] = (uint8_t)p;
+    s_depth++;
+}
+
+void perf_end(perf_phase_t p) {
+    (void)p;
+    charge(time_us_32());
+    if (s_depth) s_depth--;
+}
+
+void perf_note(uint16_t v) { s_note = v; }
+
+void perf_frame(void) {
+    uint32_t now = time_us_32();
+    charge(now);
+
+    perf_frame_t* f = &s_ring[s_seq % PERF_RING_FRAMES];
+    f->start_us = s_frame_start;
+    f->frame_us = s_seq ? now - s_frame_start : 0;
+    for (int i = 0; i < PERF_PHASES; i++) {
+        f->phase_us[i] = s_acc[i] > UINT16_MAX ? UINT16_MAX : (uint16_t)s_acc[i];
+        s_acc[i] = 0;
+    }
+    f->note = s_note;
+    s_seq++;
+    s_frame_start = now;
+
+    int c = getchar_timeout_us(0);
+    if (c == 'o') s_overlay = !s_overlay;
+    else if (c == 'd') perf_dump();
+}
+
+int perf_recent(perf_frame_t* out, int max) {
+    uint32_t n = s_seq < PERF_RING_FRAMES ? s_seq : PERF_RING_FRAMES;
+    if ((uint32_t)max < n) n = (uint32_t)max;
+    for (uint32_t i = 0; i < n; i++) out[i] = s_ring[(s_seq - n + i) % PERF_RING_FRAMES];
+    return (int)n;
+}
+
+void perf_dump(void) {
+    uint32_t n = s_seq < PERF_RING_FRAMES ? s_seq : PERF_RING_FRAMES;
+    for (uint32_t seq = s_seq - n; seq != s_seq; seq++) {
+        const perf_frame_t* f = &s_ring[seq % PERF_RING_FRAMES];
+        printf("perf,%lu,%lu,%lu,%u,%u,%u,%u,%u\n", (unsigned long)seq,
+               (unsigned long)f->start_us, (unsigned long)f->frame_us,
+               f->phase_us[PERF_INPUT], f->phase_us[PERF_SIM],
+               f->phase_us[PERF_RENDER], f->phase_us[PERF_PRESENT], f->note);
+    }
+}
+
+void perf_overlay_set(bool on) { s_overlay = on; }
+bool perf_overlay_enabled(void) { return s_overlay; }
+
+// ---- Overlay ----------------------------------------------------------------
+// 38x17 box in the top right: fps over the last 16 frames, then one column
+// per frame for the last 32, bottom-aligned
+
+#define OV_W     38
+#define OV_H     17
+#define OV_X     (128 - OV_W)
+#define OV_SPARK 32
+
+void perf_overlay_draw(void) {
+    if (!s_overlay) return;
+
+    perf_frame_t recent[OV_SPARK];
+    int n = perf_recent(recent, OV_SPARK);
+
+    uint32_t sum = 0;
+    int avg_n = 0;
+    for (int i = n - 1; i >= 0 && avg_n < 16; i--, avg_n++) sum += recent[i].frame_us;
+    uint32_t fps = sum ? (uint32_t)((uint64_t)avg_n * 1000000u / sum) : 0;
+
+    char text[8];
+    snprintf(text, sizeof(text), "%lufps", (unsigned long)(fps > 999 ? 999 : fps));
+    gfx_fill_rect(OV_X, 0, OV_W, OV_H, false);
+    gfx_text5x7(OV_X + 1, 0, text, true);
+
+    int x = OV_X + 3 + (OV_SPARK - n);
+    for (int i = 0; i < n; i++, x++) {
+        uint32_t h = (recent[i].frame_us + PERF_SPARK_US_PER_PX - 1) / PERF_SPARK_US_PER_PX;
+        if (h < 1) h = 1;
+        if (h > 8) h = 8;
+        gfx_vline(x, OV_H - (int)h, (int)h, true);
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Frame timing. Code brackets its work with begin/end markers for one of
+// the phases below; markers nest, and an inner phase pauses the outer one,
+// so each frame's phase times don't overlap. gfx_show() and
+// oled_present_mono_1bpp() time the present and close the frame. Time in
+// no phase (sleeping until the next frame, unmarked code) is the rest of
+// frame_us.
+//
+// The last PERF_RING_FRAMES frames are kept for perf_dump(). The overlay
+// draws the fps and a frame time sparkline into the top right corner just
+// before each present.
+//
+// Over stdio, 'o' toggles the overlay and 'd' dumps the ring.
+
+typedef enum {
+    PERF_INPUT = 0,
+    PERF_SIM,
+    PERF_RENDER,
+    PERF_PRESENT,
+    PERF_PHASES
+} perf_phase_t;
+
+#ifndef PERF_RING_FRAMES
+#define PERF_RING_FRAMES 128
+#endif
+
+// Overlay state after boot
+#ifndef PERF_OVERLAY
+#define PERF_OVERLAY 0
+#endif
+
+// Sparkline scale: frame time per pixel of height (8 px)
+#ifndef PERF_SPARK_US_PER_PX
+#define PERF_SPARK_US_PER_PX 5000
+#endif
+
+typedef struct {
+    uint32_t start_us;                  // time_us_32() at the previous frame's end
+    uint32_t frame_us;
+    uint16_t phase_us[PERF_PHASES];     // Saturated at UINT16_MAX
+    uint16_t note;                      // perf_note() value during the frame
+} perf_frame_t;
+
+void perf_begin(perf_phase_t p);
+void perf_end(perf_phase_t p);
+
+// Runs the statement or block after it as phase p:
+//   PERF_SCOPE(PERF_RENDER) { ... }
+#define PERF_SCOPE(p) \
+    for (int perf_once_ = (perf_begin(p), 1); perf_once_; perf_once_ = (perf_end(p), 0))
+
+// Close the current frame (after its present)
+void perf_frame(void);
+
+// Record a program value with the frame (e.g. Dino's speed)
+void perf_note(uint16_t v);
+
+// Copy up to max of the most recent frames, oldest first. Returns the count.
+int perf_recent(perf_frame_t* out, int max);
+
+// printf the ring as CSV:
+//   perf,seq,start_us,frame_us,input_us,sim_us,render_us,present_us,note
+void perf_dump(void);
+
+void perf_overlay_set(bool on);
+bool perf_overlay_enabled(void);
+
+// Draw the overlay into the gfx target if enabled (gfx calls this)
+void perf_overlay_draw(void);
+
+#endif // PERF_H
@@ -0,0 +1,315 @@
+#include "present.h"
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "ssd1306_transport.h"
+
+// Per page a 6-byte window command and a full row of data
+#define SLOT_BYTES    ((SSD1306_HEIGHT / 8) * (SSD1306_WIDTH + 6))
+#define SLOT_SEGMENTS ((SSD1306_HEIGHT / 8) * 2)
+
+typedef struct {
+    uint16_t start;
+    uint16_t len;
+    bool data;
+} segment_t;
+
+typedef struct {
+    bool frame;                 // A present (counts, runs the callback)
+    uint8_t seg_count;
+    uint16_t data_bytes;
+    uint32_t queued_us;
+    segment_t segs[SLOT_SEGMENTS];
+    uint8_t bytes[SLOT_BYTES];
+} slot_t;
+
+typedef struct {
+    ssd1306_transport_t base;
+    ssd1306_transport_t* io;
+    bool core1;
+    bool started;
+
+    // Slots go out and come back in order
+    uint8_t head;               // Oldest slot in flight
+    volatile uint8_t in_flight;
+    slot_t slots[PRESENT_SLOTS];
+
+    // Stats; written on core 0 (thread + FIFO IRQ) except bus_us
+    uint32_t since_us;
+    uint32_t frames, sent, bytes, core0_us;
+    uint32_t latency_sum, latency_max;
+    volatile uint32_t bus_us;
+} present_t;
+
+static present_t s_present;
+
+// ---- Completion (core 0) ----------------------------------------------------
+
+static void slot_done(present_t* p) {
+    slot_t* s = &p->slots[p->head];
+    p->head = (p->head + 1) % PRESENT_SLOTS;
+    p->in_flight--;
+    if (!s->frame) return;
+
+    uint32_t latency = time_us_32() - s->queued_us;
+    p->frames++;
+    p->sent++;
+    p->bytes += s->data_bytes;
+    p->latency_sum += latency;
+    if (latency > p->latency_max) p->latency_max = latency;
+    if (p->base.done) p->base.done(p->base.done_user);
+}
+
+static void __isr present_fifo_irq(void) {
+    while (multicore_fifo_rvalid()) {
+        (void)multicore_fifo_pop_blocking();
+        slot_done(&s_present);
+    }
+    multicore_fifo_clear_irq();
+}
+
+// Pass-through mode: the transport's DMA IRQ reports each present
+static void passthrough_done(void* user) {
+    slot_done((present_t*)user);
+}
+
+// ---- Bus side ---------------------------------------------------------------
+
+// Write a slot out through the transport's blocking calls
+static void run_slot(present_t* p, const slot_t* s) {
+    uint32_t t0 = time_us_32();
+    for (int i = 0; i < s->seg_count; i++) {
+        const segment_t* g = &s->segs[i];
+        if (g->data)
+            p->io->data(p->io, &s->bytes[g->start], g->len);
+        else
+            p->io->command(p->io, &s->bytes[g->start], g->len);
+    }
+    p->bus_us += time_us_32() - t0;
+}
+
+static void core1_main(void) {
+    present_t* p = &s_present;
+    uint8_t next = 0;
+    while (true) {
+        (void)multicore_fifo_pop_blocking();
+        __dmb();
+
+        slot_t* s = &p->slots[next];
+        next = (next + 1) % PRESENT_SLOTS;
+        run_slot(p, s);
+
+        __dmb();
+        multicore_fifo_push_blocking(0);
+    }
+}
+
+// ---- Proxy transport (core 0) -----------------------------------------------
+
+static slot_t* take_slot(present_t* p) {
+    while (p->in_flight == PRESENT_SLOTS) tight_loop_contents();
+    slot_t* s = &p->slots[(p->head + p->in_flight) % PRESENT_SLOTS];
+    s->seg_count = 0;
+    s->data_bytes = 0;
+    s->frame = false;
+    return s;
+}
+
+static uint8_t* add_segment(slot_t* s, bool data, uint16_t len) {
+    uint16_t start = s->seg_count ? s->segs[s->seg_count - 1].start + s->segs[s->seg_count - 1].len : 0;
+    s->segs[s->seg_count++] = (segment_t){ start, len, data };
+    return &s->bytes[start];
+}
+
+static void send_slot(present_t* p, slot_t* s) {
+    s->queued_us = time_us_32();
+    uint32_t irq = save_and_disable_interrupts();
+    p->in_flight++;
+    restore_interrupts(irq);
+    __dmb();
+    multicore_fifo_push_blocking(0);
+}
+
+static void proxy_write(present_t* p, bool data, const uint8_t* bytes, size_t n) {
+    while (n) {
+        size_t chunk = n < SLOT_BYTES ? n : SLOT_BYTES;
+        slot_t* s = take_slot(p);
+        memcpy(add_segment(s, data, (uint16_t)chunk), bytes, chunk);
+        send_slot(p, s);
+        bytes += chunk;
+        n -= chunk;
+    }
+}
+
+static void proxy_command(ssd1306_transport_t* base, const uint8_t* cmds, size_t n) {
+    present_t* p = (present_t*)base;
+    if (p->core1)
+        proxy_write(p, false, cmds, n);
+    else
+        p->io->command(p->io, cmds, n);
+}
+
+static void proxy_data(ssd1306_transport_t* base, const uint8_t* data, size_t n) {
+    present_t* p = (present_t*)base;
+    if (p->core1)
+        proxy_write(p, true, data, n);
+    else
+        p->io->data(p->io, data, n);
+}
+
+static bool proxy_async_init(ssd1306_transport_t* base) {
+    return base->async;
+}
+
+static void proxy_queue(ssd1306_transport_t* base, const ssd1306_window_t* win, int count,
+                        const uint8_t* buf, uint8_t width) {
+    present_t* p = (present_t*)base;
+    uint32_t t0 = time_us_32();
+    slot_t* s = take_slot(p);
+    s->frame = true;
+
+    if (p->core1 || !p->io->async) {
+        // Gather each window behind its address command
+        for (int i = 0; i < count; i++) {
+            const ssd1306_window_t* w = &win[i];
+            int n = w->x1 - w->x0 + 1;
+            uint8_t* c = add_segment(s, false, 6);
+            c[0] = 0x21; c[1] = w->x0; c[2] = w->x1;
+            c[3] = 0x22; c[4] = w->p0; c[5] = w->p1;
+
+            uint8_t* d = add_segment(s, true, (uint16_t)(n * (w->p1 - w->p0 + 1)));
+            for (int page = w->p0; page <= w->p1; page++, d += n)
+                memcpy(d, &buf[width * page + w->x0], n);
+            s->data_bytes += (uint16_t)(n * (w->p1 - w->p0 + 1));
+        }
+        if (p->core1) {
+            send_slot(p, s);
+        } else {
+            // No core 1 and no DMA: write it out now, so blocking presents
+            // go through the same accounting
+            s->queued_us = time_us_32();
+            p->in_flight++;
+            run_slot(p, s);
+            slot_done(p);
+        }
+    } else {
+        for (int i = 0; i < count; i++)
+            s->data_bytes += (uint16_t)((win[i].x1 - win[i].x0 + 1) * (win[i].p1 - win[i].p0 + 1));
+        s->queued_us = time_us_32();
+        uint32_t irq = save_and_disable_interrupts();
+        p->in_flight++;
+        restore_interrupts(irq);
+        p->io->queue(p->io, win, count, buf, width);
+    }
+    p->core0_us += time_us_32() - t0;
+}
+
+// Nothing changed: the frame is on the panel already
+static void proxy_skip(ssd1306_transport_t* base) {
+    present_t* p = (present_t*)base;
+    uint32_t irq = save_and_disable_interrupts();
+    p->frames++;
+    restore_interrupts(irq);
+    if (p->base.done) p->base.done(p->base.done_user);
+}
+
+static bool proxy_busy(ssd1306_transport_t* base) {
+    return ((present_t*)base)->in_flight != 0;
+}
+
+static void proxy_wait(ssd1306_transport_t* base) {
+    present_t* p = (present_t*)base;
+    while (p->in_flight) tight_loop_contents();
+    if (!p->core1 && p->io->async) p->io->wait(p->io);
+}
+
+// ---- Public API -------------------------------------------------------------
+
+ssd1306_transport_t* present_start(ssd1306_transport_t* io, bool core1) {
+    present_t* p = &s_present;
+    if (p->started) {
+        proxy_wait(&p->base);
+        return &p->base;
+    }
+
+    memset(p, 0, sizeof(*p));
+    p->io = io;
+    p->base.command = proxy_command;
+    p->base.data = proxy_data;
+    p->base.async_init = proxy_async_init;
+    p->base.queue = proxy_queue;
+    p->base.busy = proxy_busy;
+    p->base.wait = proxy_wait;
+    p->base.skip = proxy_skip;
+
+    // Always async: presents go through proxy_queue, whichever way they
+    // reach the bus
+    p->base.async = true;
+
+    if (core1) {
+        multicore_launch_core1(core1_main);
+        multicore_fifo_clear_irq();
+        irq_set_exclusive_handler(SIO_IRQ_PROC0, present_fifo_irq);
+        irq_set_enabled(SIO_IRQ_PROC0, true);
+        p->core1 = true;
+    } else if (io->async_init && io->async_init(io)) {
+        io->done = passthrough_done;
+        io->done_user = p;
+    }
+
+    p->started = true;
+    present_reset_stats();
+    return &p->base;
+}
+
+void present_get_stats(present_stats_t* out) {
+    present_t* p = &s_present;
+    uint32_t irq = save_and_disable_interrupts();
+    out->frames = p->frames;
+    out->bytes = p->bytes;
+    out->elapsed_us = time_us_32() - p->since_us;
+    out->core0_us = p->core0_us;
+    out->bus_us = p->bus_us;
+    out->latency_avg_us = p->sent ? p->latency_sum / p->sent : 0;
+    out->latency_max_us = p->latency_max;
+    restore_interrupts(irq);
+}
+
+void present_reset_stats(void) {
+    present_t* p = &s_present;
+    uint32_t irq = save_and_disable_interrupts();
+    p->since_us = time_us_32();
+    p->frames = p->sent = p->bytes = p->core0_us = 0;
+    p->latency_sum = p->latency_max = 0;
+    p->bus_us = 0;
+    restore_interrupts(irq);
+}
+
+void present_report(const char* tag) {
+    present_stats_t st;
+    present_get_stats(&st);
+    uint32_t ms = st.elapsed_us / 1000 ? st.elapsed_us / 1000 : 1;
+    printf("%s: %s, %lu frames in %lu ms (%lu.%lu fps, %lu B/s), core0 %lu us/frame, "
+           "bus %lu%%, latency avg %lu max %lu us\n",
+           tag, s_present.core1 ? "core 1" : "core 0",
+           (unsigned long)st.frames, (unsigned long)ms,
+           (unsigned long)(st.frames * 1000 / ms), (unsigned long)(st.frames * 10000 / ms % 10),
+           (unsigned long)((uint64_t)st.bytes * 1000 / ms),
+           (unsigned long)(st.frames ? st.core0_us / st.frames : 0),
+           (unsigned long)((uint64_t)st.bus_us * 100 / (st.elapsed_us ? st.elapsed_us : 1)),
+           (unsigned long)st.latency_avg_us, (unsigned long)st.latency_max_us);
+}
+
+void present_get_bus_stats(ssd1306_bus_stats_t* out) {
+    present_t* p = &s_present;
+    if (!p->started) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    uint32_t irq = save_and_disable_interrupts();
+    *out = p->io->stats;
+    restore_interrupts(irq);
+}
@@ -0,0 +1,51 @@
+#ifndef PRESENT_H
+#define PRESENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ssd1306.h"
+#include "ssd1306_transport.h"
+
+// Present service: puts a transport behind a proxy transport so the panel
+// can be driven from core 1. Core 0 keeps drawing into ssd1306_t.buf; each
+// present (and each command/data write) is copied into a slot, and the
+// slot index goes to core 1 over the multicore FIFO. Core 1 owns the slot
+// until it has written it to the bus, then hands the index back; the SIO
+// FIFO IRQ on core 0 frees it and runs the present callback.
+//
+// Without core 1 the proxy passes straight through to the transport's own
+// async (DMA) path, or without DMA writes each present out before
+// returning. Every mode keeps the same counters, so they can be compared.
+
+// Slots in flight between the cores
+#ifndef PRESENT_SLOTS
+#define PRESENT_SLOTS 2
+#endif
+
+typedef struct {
+    uint32_t frames;            // Presents that reached the panel (static ones included)
+    uint32_t bytes;             // Display data bytes in those presents
+    uint32_t elapsed_us;        // Since the last reset
+    uint32_t core0_us;          // Core 0 time spent inside present calls
+    uint32_t bus_us;            // Time in blocking bus writes (core 1, or core 0 without DMA)
+    uint32_t latency_avg_us;    // Queued -> on the panel, presents that sent something
+    uint32_t latency_max_us;
+} present_stats_t;
+
+// Start the service on io and return the proxy to init the display with.
+// core1: run the bus on core 1 (io must not be async), otherwise enable
+// io's async path (blocking if it has none) and present from core 0. Only
+// one service can run; calling again returns the same proxy once it is
+// idle.
+ssd1306_transport_t* present_start(ssd1306_transport_t* io, bool core1);
+
+void present_get_stats(present_stats_t* out);
+void present_reset_stats(void);
+
+// printf one line of stats, prefixed with tag
+void present_report(const char* tag);
+
+// Snapshot of the bus transport's traffic counters (zero before start)
+void present_get_bus_stats(ssd1306_bus_stats_t* out);
+
+#endif
@@ -0,0 +1,117 @@
+#include "prof.h"
+
+_Static_assert(PROF_SLOTS >= 2 && (PROF_SLOTS & (PROF_SLOTS - 1)) == 0, "PROF_SLOTS must be a power of two");
+
+#if PC_PROFILE && !PICOF_HOST
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+typedef struct {
+    uint32_t pc;                // 0 = free
+    uint32_t count;
+} slot_t;
+
+// Probes before a sample counts as dropped
+#define PROF_PROBES 8
+
+// log2(PROF_SLOTS): the index is the top bits of a multiplicative hash,
+// which depend on the whole PC (the low bits would only see pc mod 4 KiB)
+#define PROF_SLOT_BITS __builtin_ctz(PROF_SLOTS)
+
+static slot_t s_slots[PROF_SLOTS];
+static volatile uint32_t s_samples, s_dropped;
+static int s_alarm = -1;
+static uint32_t s_period_us;
+static bool s_running;
+
+// ---- Sampling IRQ -----------------------------------------------------------
+// The handler sits straight in the vector table, so on entry LR holds
+// EXC_RETURN and the exception frame (r0-r3, r12, lr, pc, xpsr) is on the
+// stack it names. The naked shim passes that frame to prof_sample and
+// returns through EXC_RETURN.
+
+__attribute__((used)) void __not_in_flash_func(prof_sample)(const uint32_t* frame) {
+    timer_hw->intr = 1u << s_alarm;
+    timer_hw->alarm[s_alarm] = timer_hw->timerawl + s_period_us;
+
+    uint32_t pc = frame[6];
+    uint32_t h = ((pc >> 1) * 2654435761u) >> (32 - PROF_SLOT_BITS);
+    s_samples++;
+    for (int i = 0; i < PROF_PROBES; i++) {
+        slot_t* s = &s_slots[(h + (uint32_t)i) & (PROF_SLOTS - 1)];
+        if (s->pc == pc) {
+            s->count++;
+            return;
+        }
+        if (!s->pc) {
+            s->pc = pc;
+            s->count = 1;
+            return;
+        }
+    }
+    s_dropped++;
+}
+
+static void __attribute__((naked)) __not_in_flash_func(prof_isr)(void) {
+    __asm volatile(
+        "movs r0, #4      \n"
+        "mov  r1, lr      \n"
+        "tst  r0, r1      \n"
+        "beq  1f          \n"
+        "mrs  r0, psp     \n"
+        "b    2f          \n"
+        "1:               \n"
+        "mrs  r0, msp     \n"
+        "2:               \n"
+        "push {r2, lr}    \n"  // Two words keep the stack 8-byte aligned
+        "bl   prof_sample \n"
+        "pop  {r2, pc}    \n");
+}
+
+// ---- Control ----------------------------------------------------------------
+
+bool prof_start(void) {
+    if (s_running) prof_stop();
+    if (s_alarm < 0) {
+        s_alarm = hardware_alarm_claim_unused(false);
+        if (s_alarm < 0) return false;
+        irq_set_exclusive_handler(TIMER_IRQ_0 + s_alarm, prof_isr);
+        irq_set_priority(TIMER_IRQ_0 + s_alarm, 0);
+    }
+
+    memset(s_slots, 0, sizeof(s_slots));
+    s_samples = s_dropped = 0;
+    s_period_us = 1000000u / PC_PROFILE_HZ;
+
+    timer_hw->intr = 1u << s_alarm;
+    hw_set_bits(&timer_hw->inte, 1u << s_alarm);
+    irq_set_enabled(TIMER_IRQ_0 + s_alarm, true);
+    timer_hw->alarm[s_alarm] = timer_hw->timerawl + s_period_us;
+    s_running = true;
+    return true;
+}
+
+void prof_stop(void) {
+    if (!s_running) return;
+    irq_set_enabled(TIMER_IRQ_0 + s_alarm, false);
+    hw_clear_bits(&timer_hw->inte, 1u << s_alarm);
+    timer_hw->armed = 1u << s_alarm;    // Write 1 disarms
+    timer_hw->intr = 1u << s_alarm;
+    s_running = false;
+}
+
+void prof_dump(const char* name) {
+    printf("prof_begin,%s,%u,%lu,%lu\n", name, (unsigned)PC_PROFILE_HZ,
+           (unsigned long)s_samples, (unsigned long)s_dropped);
+    for (int i = 0; i < PROF_SLOTS; i++) {
+        if (s_slots[i].pc)
+            printf("prof,0x%08lx,%lu\n", (unsigned long)s_slots[i].pc, (unsigned long)s_slots[i].count);
+    }
+    printf("prof_end,%s\n", name);
+}
+
+#endif
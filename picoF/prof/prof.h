@@ -0,0 +1,42 @@
+#ifndef PROF_H
+#define PROF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "hardware_config.h"
+
+// Sampling profiler. A hardware alarm of its own interrupts core 0
+// PC_PROFILE_HZ times a second, at the highest IRQ priority, and counts
+// the interrupted PC in a hash table. The launcher profiles each program
+// from launch to exit and then prints the table over stdio:
+//   prof_begin,program,hz,samples,dropped
+//   prof,0x<pc>,count          (one per distinct PC)
+//   prof_end,program
+// dropped counts samples that found the table full. tools/pcprof/pcprof.py
+// symbolizes the PCs against picoF.elf and prints a flat profile.
+//
+// Device only; the host build gets the no-op stubs.
+
+// Distinct PCs the table holds (power of two)
+#ifndef PROF_SLOTS
+#define PROF_SLOTS 2048
+#endif
+
+#if PC_PROFILE && !PICOF_HOST
+
+// Clear the table and start sampling. False if no hardware alarm is free.
+bool prof_start(void);
+void prof_stop(void);
+
+// printf the table, tagged with name
+void prof_dump(const char* name);
+
+#else
+
+static inline bool prof_start(void) { return false; }
+static inline void prof_stop(void) {}
+static inline void prof_dump(const char* name) { (void)name; }
+
+#endif
+
+#endif // PROF_H
@@ -1,8 +1,10 @@
 #include "registry.h"
 #include "input/input.h" // for ProgramID
-
-extern const ProgramEntry __start_prog_registry[];
-extern const ProgramEntry __stop_prog_registry[];
+#include "gameloop.h"
+#include "busprof.h"
+#include "perf.h"
+#include "prof.h"
+#include "pico/time.h"
 
 // Track active program
 static ProgramID active_program = PROGRAM_MENU;
@@ -14,3 +16,77 @@ void registry_set_active_program(ProgramID p) {
 ProgramID current_program_id(void) {
     return active_program;
 }
+
+// ---- Lifecycle ----
+#define REGISTRY_MAX_PROGRAMS 32
+
+static bool suspended[REGISTRY_MAX_PROGRAMS];
+
+typedef struct {
+    const ProgramOps* ops;
+    bool suspend;
+} Launch;
+
+static bool launch_update(void* user) {
+    Launch* l = user;
+    input_update(to_ms_since_boot(get_absolute_time()));
+    if (exit_combo_triggered()) {
+        l->suspend = true;
+        return false;
+    }
+    bool more;
+    PERF_SCOPE(PERF_SIM) more = l->ops->update();
+    return more;
+}
+
+static void launch_render(void* user, uint8_t alpha) {
+    Launch* l = user;
+    if (l->ops->render) PERF_SCOPE(PERF_RENDER) l->ops->render(alpha);
+}
+
+bool registry_suspended(uint32_t idx) {
+    return idx < REGISTRY_MAX_PROGRAMS && suspended[idx];
+}
+
+// Profiles cover the program from launch until it hands the display back
+static void profile_start(const ProgramEntry* e) {
+    busprof_program(e->name);
+    prof_start();
+}
+
+static void profile_end(const ProgramEntry* e) {
+    prof_stop();
+    prof_dump(e->name);
+    busprof_program("menu");
+}
+
+void registry_launch(uint32_t idx) {
+    const ProgramEntry* e = registry_entry(idx);
+    profile_start(e);
+    if (!e->ops) {
+        registry_set_active_program(PROGRAM_ANIMATION);
+        e->run();
+        profile_end(e);
+        return;
+    }
+
+    const ProgramOps* ops = e->ops;
+    registry_set_active_program(ops->input);
+    bool warm = registry_suspended(idx);
+    if (warm && ops->resume) ops->resume();
+    if (!warm && ops->init) ops->init();
+
+    static gameloop_t loop;
+    Launch l = { ops, false };
+    gameloop_init(&loop, ops->step_us, launch_update, launch_render, &l);
+    gameloop_run(&loop);
+    gameloop_report(&loop, e->name);
+
+    if (l.suspend) {
+        if (ops->suspend) ops->suspend();
+    } else if (ops->exit) {
+        ops->exit();
+    }
+    if (idx < REGISTRY_MAX_PROGRAMS) suspended[idx] = l.suspend;
+    profile_end(e);
+}
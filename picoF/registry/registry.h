@@ -1,14 +1,43 @@
 #ifndef REGISTRY_H
 #define REGISTRY_H
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "input/input.h" // for ProgramID
 
 typedef void (*ProgramFunc)(void);
 
+// Lifecycle callbacks. The launcher owns the loop: it calls init on a cold
+// start (resume instead after a suspend), then update at a fixed step_us
+// and render once per frame. The exit combo suspends the program and
+// returns to the menu with its state kept; update returning false exits.
+// Hardware, gfx and input are already set up. Every callback but update
+// is optional.
+typedef struct {
+    uint32_t step_us;
+    ProgramID input;        // Button mapping while running (see input.c)
+    void (*init)(void);
+    bool (*update)(void);
+    void (*render)(uint8_t alpha);  // alpha: Q8 fraction of a step, see gameloop.h
+    void (*suspend)(void);
+    void (*resume)(void);
+    void (*exit)(void);
+} ProgramOps;
+
+// Entries are collected in their own section. GNU ld and lld provide
+// __start_/__stop_ symbols for it; Mach-O names the section by segment and
+// exposes its bounds through section$start/section$end.
+#if defined(__APPLE__)
+#define PROG_REGISTRY_SECTION "__DATA,prog_registry"
+#else
+#define PROG_REGISTRY_SECTION "prog_registry"
+#endif
+
 typedef struct {
     const char *name;       // Display name shown in the launcher
-    ProgramFunc run;        // Function to run the program (run_##ID)
+    ProgramFunc run;        // Blocking entry point (run_##ID), or NULL
     const uint8_t *icon;    // Optional icon data (can be NULL)
+    const ProgramOps *ops;  // Lifecycle callbacks, or NULL for run()
 } ProgramEntry;
 
 // Register a program using a C identifier (ID), a display string, and an icon pointer.
@@ -18,12 +47,27 @@ typedef struct {
 //   // Emits registry entry with name="Dino", run=run_dino, icon=NULL
 #define REGISTER_PROGRAM(ID, DISPLAY, ICON) \
     void run_##ID(void); \
-    __attribute__((used, section("prog_registry"))) \
-    static const ProgramEntry _reg_##ID = { DISPLAY, run_##ID, ICON };
+    __attribute__((used, section(PROG_REGISTRY_SECTION))) \
+    static const ProgramEntry _reg_##ID = { DISPLAY, run_##ID, ICON, NULL };
+
+// Register a program driven by the launcher through ProgramOps.
+// Example:
+//   REGISTER_PROGRAM_OPS(dino, "Dino", NULL,
+//       .step_us = 33000, .input = PROGRAM_DINO, .init = dino_init, .update = dino_update,
+//       .render = dino_render);
+#define REGISTER_PROGRAM_OPS(ID, DISPLAY, ICON, ...) \
+    static const ProgramOps _ops_##ID = { __VA_ARGS__ }; \
+    __attribute__((used, section(PROG_REGISTRY_SECTION))) \
+    static const ProgramEntry _reg_##ID = { DISPLAY, NULL, ICON, &_ops_##ID };
 
-// Accessors backed by GNU ld start/stop section symbols
+// Accessors backed by the linker's start/stop section symbols
+#if defined(__APPLE__)
+extern const ProgramEntry __start_prog_registry[] __asm("section$start$__DATA$prog_registry");
+extern const ProgramEntry __stop_prog_registry[] __asm("section$end$__DATA$prog_registry");
+#else
 extern const ProgramEntry __start_prog_registry[];
 extern const ProgramEntry __stop_prog_registry[];
+#endif
 
 static inline uint32_t registry_count(void) {
     return (uint32_t)(__stop_prog_registry - __start_prog_registry);
@@ -33,9 +77,14 @@ static inline const ProgramEntry* registry_entry(uint32_t idx) {
     return &__start_prog_registry[idx];
 }
 // --- Added for program-aware input mapping ---
-#include "input/input.h" // for ProgramID enum
-
 void registry_set_active_program(ProgramID p);
 ProgramID current_program_id(void);
 
+// Run entry idx until it returns, exits or is suspended. Selects the
+// entry's button mapping (none for run() entries) while it runs.
+void registry_launch(uint32_t idx);
+
+// True if entry idx is suspended and will resume on the next launch
+bool registry_suspended(uint32_t idx);
+
 #endif // REGISTRY_H
@@ -1,57 +1,194 @@
 #include "ssd1306.h"
+#include "ssd1306_transport.h"
+#include "font.h"
 #include "pico/stdlib.h"
 #include <string.h>
 
-static void ssd1306_command(ssd1306_t* s, uint8_t cmd) {
-    uint8_t buf[2] = {0x00, cmd};
-    i2c_write_blocking(s->i2c, s->address, buf, 2, false);
+// One window's worth of data, gathered from the framebuffer rows
+static uint8_t tx_buf[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+
+static void ssd1306_commands(ssd1306_t* s, const uint8_t* cmds, size_t n) {
+    s->io->command(s->io, cmds, n);
+}
+
+static void ssd1306_window(ssd1306_t* s, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    const uint8_t cmds[] = { 0x21, x0, x1, 0x22, p0, p1 };
+    ssd1306_commands(s, cmds, sizeof(cmds));
 }
 
-void ssd1306_init(ssd1306_t* s, i2c_inst_t* i2c, uint8_t addr, uint8_t w, uint8_t h) {
+void ssd1306_init_transport(ssd1306_t* s, ssd1306_transport_t* io, uint8_t w, uint8_t h) {
     s->width = w;
     s->height = h;
     s->pages = h / 8;
-    s->address = addr;
-    s->i2c = i2c;
+    s->io = io;
+    s->present_mode = SSD1306_PRESENT_DIRTY;
 
     memset(s->buf, 0, sizeof(s->buf));
+    ssd1306_invalidate(s);
+
+    // Init sequence, sent as one command stream
+    const uint8_t init[] = {
+        0xAE,                   // Display off
+        0x20, 0x00,             // Horizontal addressing
+        0xB0,
+        0xC8,
+        0x00,
+        0x10,
+        0x40,
+        0x81, 0x7F,
+        0xA1,
+        0xA6,
+        0xA8, (uint8_t)(s->height - 1),
+        0xA4,
+        0xD3, 0x00,
+        0xD5, 0x80,
+        0xD9, 0xF1,
+        0xDA, 0x12,
+        0xDB, 0x40,
+        0x8D, 0x14,
+        0xAF,                   // Display on
+    };
+    ssd1306_commands(s, init, sizeof(init));
+}
 
-    // Init sequence
-    ssd1306_command(s, 0xAE); // Display off
-    ssd1306_command(s, 0x20); ssd1306_command(s, 0x00); // Horizontal addressing
-    ssd1306_command(s, 0xB0);
-    ssd1306_command(s, 0xC8);
-    ssd1306_command(s, 0x00);
-    ssd1306_command(s, 0x10);
-    ssd1306_command(s, 0x40);
-    ssd1306_command(s, 0x81); ssd1306_command(s, 0x7F);
-    ssd1306_command(s, 0xA1);
-    ssd1306_command(s, 0xA6);
-    ssd1306_command(s, 0xA8); ssd1306_command(s, s->height - 1);
-    ssd1306_command(s, 0xA4);
-    ssd1306_command(s, 0xD3); ssd1306_command(s, 0x00);
-    ssd1306_command(s, 0xD5); ssd1306_command(s, 0x80);
-    ssd1306_command(s, 0xD9); ssd1306_command(s, 0xF1);
-    ssd1306_command(s, 0xDA); ssd1306_command(s, 0x12);
-    ssd1306_command(s, 0xDB); ssd1306_command(s, 0x40);
-    ssd1306_command(s, 0x8D); ssd1306_command(s, 0x14);
-    ssd1306_command(s, 0xAF); // Display on
+void ssd1306_set_present_mode(ssd1306_t* s, ssd1306_present_t mode) {
+    s->present_mode = (uint8_t)mode;
+}
+
+static inline void mark_span(ssd1306_t* s, int page, int x0, int x1) {
+    if (x0 < s->dirty_x0[page]) s->dirty_x0[page] = (uint8_t)x0;
+    if (x1 > s->dirty_x1[page]) s->dirty_x1[page] = (uint8_t)x1;
+}
+
+void ssd1306_mark_dirty(ssd1306_t* s, int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > s->width) w = s->width - x;
+    if (y + h > s->height) h = s->height - y;
+    if (w <= 0 || h <= 0) return;
+    for (int page = y / 8; page <= (y + h - 1) / 8; page++) {
+        mark_span(s, page, x, x + w - 1);
+    }
+}
+
+void ssd1306_invalidate(ssd1306_t* s) {
+    s->gram_valid = false;
+    for (uint8_t page = 0; page < s->pages; page++) {
+        s->dirty_x0[page] = 0;
+        s->dirty_x1[page] = s->width - 1;
+    }
 }
 
 void ssd1306_clear(ssd1306_t* s) {
     memset(s->buf, 0, sizeof(s->buf));
+    ssd1306_mark_dirty(s, 0, 0, s->width, s->height);
 }
 
-void ssd1306_show(ssd1306_t* s) {
+// Work out which windows the next present has to send, and treat them as
+// sent: the panel copy is updated and the dirty spans are reset.
+//
+// Dirty mode trims each page's span against the panel copy, so redrawing a
+// frame that is mostly unchanged only sends the columns that differ. Full
+// mode sends one window over the whole panel (the GRAM pointer wraps back to
+// 0,0 at the end) whenever anything changed.
+static int plan_windows(ssd1306_t* s, ssd1306_window_t* out) {
+    int count = 0;
+    uint32_t sent = 0;
+    bool dirty = !s->gram_valid;
+
     for (uint8_t page = 0; page < s->pages; page++) {
-        ssd1306_command(s, 0xB0 + page);
-        ssd1306_command(s, 0x00);
-        ssd1306_command(s, 0x10);
-
-        uint8_t data[s->width + 1];
-        data[0] = 0x40;
-        memcpy(&data[1], &s->buf[s->width * page], s->width);
-        i2c_write_blocking(s->i2c, s->address, data, sizeof(data), false);
+        int x0 = s->dirty_x0[page];
+        int x1 = s->dirty_x1[page];
+        s->dirty_x0[page] = 0xFF;
+        s->dirty_x1[page] = 0;
+        if (x0 > x1) continue;
+        dirty = true;
+        if (s->present_mode == SSD1306_PRESENT_FULL) continue;
+
+        const uint8_t* row = &s->buf[s->width * page];
+        uint8_t* shown = &s->gram[s->width * page];
+        if (s->gram_valid) {
+            while (x0 <= x1 && row[x0] == shown[x0]) x0++;
+            while (x1 >= x0 && row[x1] == shown[x1]) x1--;
+            if (x0 > x1) continue;
+        }
+
+        memcpy(&shown[x0], &row[x0], x1 - x0 + 1);
+        out[count++] = (ssd1306_window_t){ (uint8_t)x0, (uint8_t)x1, page, page };
+        sent += x1 - x0 + 1;
+    }
+
+    if (s->present_mode == SSD1306_PRESENT_FULL && dirty) {
+        sent = (uint32_t)s->width * s->pages;
+        memcpy(s->gram, s->buf, sent);
+        out[count++] = (ssd1306_window_t){ 0, (uint8_t)(s->width - 1), 0, (uint8_t)(s->pages - 1) };
+    }
+
+    s->gram_valid = true;
+    s->bytes_sent = sent;
+    s->bytes_saved = (uint32_t)s->width * s->pages - sent;
+    return count;
+}
+
+void ssd1306_show(ssd1306_t* s) {
+    if (s->frame_hook) s->frame_hook(s->frame_user);
+    ssd1306_window_t win[SSD1306_HEIGHT / 8];
+    int count = plan_windows(s, win);
+
+    for (int i = 0; i < count; i++) {
+        const ssd1306_window_t* w = &win[i];
+        int n = w->x1 - w->x0 + 1;
+        uint8_t* p = tx_buf;
+        for (int page = w->p0; page <= w->p1; page++) {
+            memcpy(p, &s->buf[s->width * page + w->x0], n);
+            p += n;
+        }
+        ssd1306_window(s, w->x0, w->x1, w->p0, w->p1);
+        s->io->data(s->io, tx_buf, p - tx_buf);
+    }
+}
+
+// ---- Async present ----------------------------------------------------------
+
+bool ssd1306_async_init(ssd1306_t* s) {
+    return s->io->async_init && s->io->async_init(s->io);
+}
+
+void ssd1306_set_present_callback(ssd1306_t* s, void (*cb)(void* user), void* user) {
+    s->io->done = cb;
+    s->io->done_user = user;
+}
+
+void ssd1306_set_frame_hook(ssd1306_t* s, void (*hook)(void* user), void* user) {
+    s->frame_hook = hook;
+    s->frame_user = user;
+}
+
+bool ssd1306_present_busy(ssd1306_t* s) {
+    return s->io->async && s->io->busy(s->io);
+}
+
+void ssd1306_wait_present(ssd1306_t* s) {
+    if (s->io->async) s->io->wait(s->io);
+}
+
+void ssd1306_present_async(ssd1306_t* s) {
+    ssd1306_transport_t* io = s->io;
+    if (!io->async) {
+        ssd1306_show(s);
+        if (io->done) io->done(io->done_user);
+        return;
+    }
+
+    if (s->frame_hook) s->frame_hook(s->frame_user);
+    ssd1306_window_t win[SSD1306_HEIGHT / 8];
+    int count = plan_windows(s, win);
+    if (count) {
+        io->queue(io, win, count, s->buf, s->width);
+    } else if (io->skip) {
+        io->skip(io);
+    } else if (io->done) {
+        io->done(io->done_user);
     }
 }
 
@@ -61,132 +198,92 @@ void ssd1306_pixel(ssd1306_t* s, int x, int y, bool colour) {
         s->buf[x + (y / 8) * s->width] |= (1 << (y & 7));
     else
         s->buf[x + (y / 8) * s->width] &= ~(1 << (y & 7));
+    mark_span(s, y / 8, x, x);
 }
 
-void ssd1306_rect(ssd1306_t* s, int x, int y, int w, int h, bool colour) {
-    for (int yy = y; yy < y + h; yy++) {
-        for (int xx = x; xx < x + w; xx++) {
-            ssd1306_pixel(s, xx, yy, colour);
-        }
+// ---- Fills ------------------------------------------------------------------
+// A rectangle covers a run of pages; per page every column gets the same
+// bit mask, so fills work a page row at a time instead of per pixel.
+
+typedef enum { FILL_CLEAR, FILL_SET, FILL_INVERT } fill_op_t;
+
+// Word access into the byte framebuffer
+typedef uint32_t __attribute__((may_alias)) fill_word_t;
+
+static void fill_span(uint8_t* p, int n, uint8_t mask, fill_op_t op) {
+    if (mask == 0xFF && op != FILL_INVERT) {
+        memset(p, op == FILL_SET ? 0xFF : 0x00, n);
+        return;
+    }
+
+    uint8_t m8 = op == FILL_CLEAR ? (uint8_t)~mask : mask;
+    uint32_t m32 = m8 * 0x01010101u;
+    int head = (int)(-(uintptr_t)p & 3);
+    if (head > n) head = n;
+    int words = (n - head) >> 2;
+    int tail = (n - head) & 3;
+    fill_word_t* w;
+
+    switch (op) {
+    case FILL_SET:
+        while (head--) *p++ |= m8;
+        for (w = (fill_word_t*)p; words--; w++) *w |= m32;
+        for (p = (uint8_t*)w; tail--; ) *p++ |= m8;
+        break;
+    case FILL_CLEAR:
+        while (head--) *p++ &= m8;
+        for (w = (fill_word_t*)p; words--; w++) *w &= m32;
+        for (p = (uint8_t*)w; tail--; ) *p++ &= m8;
+        break;
+    case FILL_INVERT:
+        while (head--) *p++ ^= m8;
+        for (w = (fill_word_t*)p; words--; w++) *w ^= m32;
+        for (p = (uint8_t*)w; tail--; ) *p++ ^= m8;
+        break;
+    }
+}
+
+static void fill(ssd1306_t* s, int x, int y, int w, int h, fill_op_t op) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > s->width) w = s->width - x;
+    if (y + h > s->height) h = s->height - y;
+    if (w <= 0 || h <= 0) return;
+
+    int y1 = y + h - 1;
+    int p0 = y >> 3, p1 = y1 >> 3;
+    uint8_t top = (uint8_t)(0xFF << (y & 7));
+    uint8_t bottom = (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+    for (int page = p0; page <= p1; page++) {
+        uint8_t mask = 0xFF;
+        if (page == p0) mask &= top;
+        if (page == p1) mask &= bottom;
+        fill_span(&s->buf[s->width * page + x], w, mask, op);
+        mark_span(s, page, x, x + w - 1);
     }
 }
 
+void ssd1306_rect(ssd1306_t* s, int x, int y, int w, int h, bool colour) {
+    fill(s, x, y, w, h, colour ? FILL_SET : FILL_CLEAR);
+}
 
-    
-// Standard ASCII 5x7 font table for SSD1306 (0x20-0x7F)
-static const uint8_t font5x7[][5] = {
-    {0x00,0x00,0x00,0x00,0x00}, // 0x20 ' '
-    {0x00,0x00,0x5F,0x00,0x00}, // 0x21 '!'
-    {0x00,0x07,0x00,0x07,0x00}, // 0x22 '"'
-    {0x14,0x7F,0x14,0x7F,0x14}, // 0x23 '#'
-    {0x24,0x2A,0x7F,0x2A,0x12}, // 0x24 '$'
-    {0x23,0x13,0x08,0x64,0x62}, // 0x25 '%'
-    {0x36,0x49,0x55,0x22,0x50}, // 0x26 '&'
-    {0x00,0x05,0x03,0x00,0x00}, // 0x27 '\''
-    {0x00,0x1C,0x22,0x41,0x00}, // 0x28 '('
-    {0x00,0x41,0x22,0x1C,0x00}, // 0x29 ')'
-    {0x14,0x08,0x3E,0x08,0x14}, // 0x2A '*'
-    {0x08,0x08,0x3E,0x08,0x08}, // 0x2B '+'
-    {0x00,0x50,0x30,0x00,0x00}, // 0x2C ','
-    {0x08,0x08,0x08,0x08,0x08}, // 0x2D '-'
-    {0x00,0x60,0x60,0x00,0x00}, // 0x2E '.'
-    {0x20,0x10,0x08,0x04,0x02}, // 0x2F '/'
-    {0x3E,0x51,0x49,0x45,0x3E}, // 0x30 '0'
-    {0x00,0x42,0x7F,0x40,0x00}, // 0x31 '1'
-    {0x42,0x61,0x51,0x49,0x46}, // 0x32 '2'
-    {0x21,0x41,0x45,0x4B,0x31}, // 0x33 '3'
-    {0x18,0x14,0x12,0x7F,0x10}, // 0x34 '4'
-    {0x27,0x45,0x45,0x45,0x39}, // 0x35 '5'
-    {0x3C,0x4A,0x49,0x49,0x30}, // 0x36 '6'
-    {0x01,0x71,0x09,0x05,0x03}, // 0x37 '7'
-    {0x36,0x49,0x49,0x49,0x36}, // 0x38 '8'
-    {0x06,0x49,0x49,0x29,0x1E}, // 0x39 '9'
-    {0x00,0x36,0x36,0x00,0x00}, // 0x3A ':'
-    {0x00,0x56,0x36,0x00,0x00}, // 0x3B ';'
-    {0x08,0x14,0x22,0x41,0x00}, // 0x3C '<'
-    {0x14,0x14,0x14,0x14,0x14}, // 0x3D '='
-    {0x00,0x41,0x22,0x14,0x08}, // 0x3E '>'
-    {0x02,0x01,0x51,0x09,0x06}, // 0x3F '?'
-    {0x32,0x49,0x79,0x41,0x3E}, // 0x40 '@'
-    {0x7E,0x11,0x11,0x11,0x7E}, // 0x41 'A'
-    {0x7F,0x49,0x49,0x49,0x36}, // 0x42 'B'
-    {0x3E,0x41,0x41,0x41,0x22}, // 0x43 'C'
-    {0x7F,0x41,0x41,0x22,0x1C}, // 0x44 'D'
-    {0x7F,0x49,0x49,0x49,0x41}, // 0x45 'E'
-    {0x7F,0x09,0x09,0x09,0x01}, // 0x46 'F'
-    {0x3E,0x41,0x49,0x49,0x7A}, // 0x47 'G'
-    {0x7F,0x08,0x08,0x08,0x7F}, // 0x48 'H'
-    {0x00,0x41,0x7F,0x41,0x00}, // 0x49 'I'
-    {0x20,0x40,0x41,0x3F,0x01}, // 0x4A 'J'
-    {0x7F,0x08,0x14,0x22,0x41}, // 0x4B 'K'
-    {0x7F,0x40,0x40,0x40,0x40}, // 0x4C 'L'
-    {0x7F,0x02,0x0C,0x02,0x7F}, // 0x4D 'M'
-    {0x7F,0x04,0x08,0x10,0x7F}, // 0x4E 'N'
-    {0x3E,0x41,0x41,0x41,0x3E}, // 0x4F 'O'
-    {0x7F,0x09,0x09,0x09,0x06}, // 0x50 'P'
-    {0x3E,0x41,0x51,0x21,0x5E}, // 0x51 'Q'
-    {0x7F,0x09,0x19,0x29,0x46}, // 0x52 'R'
-    {0x46,0x49,0x49,0x49,0x31}, // 0x53 'S'
-    {0x01,0x01,0x7F,0x01,0x01}, // 0x54 'T'
-    {0x3F,0x40,0x40,0x40,0x3F}, // 0x55 'U'
-    {0x1F,0x20,0x40,0x20,0x1F}, // 0x56 'V'
-    {0x3F,0x40,0x38,0x40,0x3F}, // 0x57 'W'
-    {0x63,0x14,0x08,0x14,0x63}, // 0x58 'X'
-    {0x07,0x08,0x70,0x08,0x07}, // 0x59 'Y'
-    {0x61,0x51,0x49,0x45,0x43}, // 0x5A 'Z'
-    {0x00,0x7F,0x41,0x41,0x00}, // 0x5B '['
-    {0x02,0x04,0x08,0x10,0x20}, // 0x5C '\\'
-    {0x00,0x41,0x41,0x7F,0x00}, // 0x5D ']'
-    {0x04,0x02,0x01,0x02,0x04}, // 0x5E '^'
-    {0x40,0x40,0x40,0x40,0x40}, // 0x5F '_'
-    {0x00,0x01,0x02,0x04,0x00}, // 0x60 '`'
-    {0x20,0x54,0x54,0x54,0x78}, // 0x61 'a'
-    {0x7F,0x48,0x44,0x44,0x38}, // 0x62 'b'
-    {0x38,0x44,0x44,0x44,0x20}, // 0x63 'c'
-    {0x38,0x44,0x44,0x48,0x7F}, // 0x64 'd'
-    {0x38,0x54,0x54,0x54,0x18}, // 0x65 'e'
-    {0x08,0x7E,0x09,0x01,0x02}, // 0x66 'f'
-    {0x0C,0x52,0x52,0x52,0x3E}, // 0x67 'g'
-    {0x7F,0x08,0x04,0x04,0x78}, // 0x68 'h'
-    {0x00,0x44,0x7D,0x40,0x00}, // 0x69 'i'
-    {0x20,0x40,0x44,0x3D,0x00}, // 0x6A 'j'
-    {0x7F,0x10,0x28,0x44,0x00}, // 0x6B 'k'
-    {0x00,0x41,0x7F,0x40,0x00}, // 0x6C 'l'
-    {0x7C,0x04,0x18,0x04,0x78}, // 0x6D 'm'
-    {0x7C,0x08,0x04,0x04,0x78}, // 0x6E 'n'
-    {0x38,0x44,0x44,0x44,0x38}, // 0x6F 'o'
-    {0x7C,0x14,0x14,0x14,0x08}, // 0x70 'p'
-    {0x08,0x14,0x14,0x18,0x7C}, // 0x71 'q'
-    {0x7C,0x08,0x04,0x04,0x08}, // 0x72 'r'
-    {0x48,0x54,0x54,0x54,0x20}, // 0x73 's'
-    {0x04,0x3F,0x44,0x40,0x20}, // 0x74 't'
-    {0x3C,0x40,0x40,0x20,0x7C}, // 0x75 'u'
-    {0x1C,0x20,0x40,0x20,0x1C}, // 0x76 'v'
-    {0x3C,0x40,0x30,0x40,0x3C}, // 0x77 'w'
-    {0x44,0x28,0x10,0x28,0x44}, // 0x78 'x'
-    {0x0C,0x50,0x50,0x50,0x3C}, // 0x79 'y'
-    {0x44,0x64,0x54,0x4C,0x44}, // 0x7A 'z'
-    {0x00,0x08,0x36,0x41,0x00}, // 0x7B '{'
-    {0x00,0x00,0x7F,0x00,0x00}, // 0x7C '|'
-    {0x00,0x41,0x36,0x08,0x00}, // 0x7D '}'
-    {0x08,0x08,0x2A,0x1C,0x08}, // 0x7E '~'
-};
+void ssd1306_hline(ssd1306_t* s, int x, int y, int w, bool colour) {
+    fill(s, x, y, w, 1, colour ? FILL_SET : FILL_CLEAR);
+}
 
+void ssd1306_vline(ssd1306_t* s, int x, int y, int h, bool colour) {
+    fill(s, x, y, 1, h, colour ? FILL_SET : FILL_CLEAR);
+}
 
+void ssd1306_invert_rect(ssd1306_t* s, int x, int y, int w, int h) {
+    fill(s, x, y, w, h, FILL_INVERT);
+}
 
 void ssd1306_char(ssd1306_t* s, int x, int y, char c, bool colour) {
-    if (c < 0x20 || c > 0x7F) c = '?';
-    for (int i = 0; i < 5; i++) {
-        uint8_t line = font5x7[c - 0x20][i];
-        for (int j = 0; j < 7; j++) {
-            ssd1306_pixel(s, x + i, y + j, (line >> j) & 1 ? colour : !colour);
-        }
-    }
+    font_draw_char(s, &font_5x7, x, y, c, colour, true);
 }
 
 void ssd1306_string(ssd1306_t* s, int x, int y, const char* str, bool colour) {
-    while (*str) {
-        ssd1306_char(s, x, y, *str++, colour);
-        x += 6;
-    }
+    font_draw_string(s, &font_5x7, x, y, str, colour, true);
 }
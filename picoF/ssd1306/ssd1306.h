@@ -7,30 +7,97 @@
 #define SSD1306_WIDTH   128
 #define SSD1306_HEIGHT   64
 
+// Byte transport (I2C, SPI, memory), see ssd1306_transport.h
+typedef struct ssd1306_transport ssd1306_transport_t;
+
+// How ssd1306_show gets the framebuffer onto the panel
+typedef enum {
+    SSD1306_PRESENT_DIRTY = 0, // Only the changed column window of each page
+    SSD1306_PRESENT_FULL,      // Whole buffer in one address window and one transaction
+} ssd1306_present_t;
+
 typedef struct {
     uint8_t width;
     uint8_t height;
     uint8_t pages;
-    uint8_t address;
-    i2c_inst_t *i2c;
+    ssd1306_transport_t *io;
     uint8_t buf[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+
+    // Dirty tracking: per-page column span touched since the last show
+    // (empty when dirty_x0 > dirty_x1), plus a copy of what the panel holds.
+    uint8_t dirty_x0[SSD1306_HEIGHT / 8];
+    uint8_t dirty_x1[SSD1306_HEIGHT / 8];
+    uint8_t gram[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    bool gram_valid;
+    uint8_t present_mode;
+
+    // Data bytes sent / skipped by the last ssd1306_show
+    uint32_t bytes_sent;
+    uint32_t bytes_saved;
+
+    // Run on the caller's thread at the start of every present
+    void (*frame_hook)(void* user);
+    void* frame_user;
 } ssd1306_t;
 
-// Initialise the display
+// Initialise an I2C display. Uses a driver-owned I2C transport, so only one
+// display can be set up this way.
 void ssd1306_init(ssd1306_t* s, i2c_inst_t* i2c, uint8_t addr, uint8_t w, uint8_t h);
 
+// Initialise a display on an already set up transport
+void ssd1306_init_transport(ssd1306_t* s, ssd1306_transport_t* io, uint8_t w, uint8_t h);
+
 // Clear the framebuffer
 void ssd1306_clear(ssd1306_t* s);
 
-// Send the framebuffer to the display
+// Send the framebuffer to the display (changed parts only, unless in full mode)
 void ssd1306_show(ssd1306_t* s);
 
+// Select how ssd1306_show transfers the framebuffer
+void ssd1306_set_present_mode(ssd1306_t* s, ssd1306_present_t mode);
+
+// Enable async presents on the transport (claims a DMA channel). Returns
+// false if the transport can't, in which case presents stay blocking.
+bool ssd1306_async_init(ssd1306_t* s);
+
+// Copy the changed windows into a front buffer and stream it to the panel
+// by DMA. Only blocks while every front buffer is still queued; s->buf can be
+// drawn into again as soon as this returns.
+void ssd1306_present_async(ssd1306_t* s);
+
+// Block until all queued presents are on the panel
+void ssd1306_wait_present(ssd1306_t* s);
+
+// True while an async present is queued or on the bus
+bool ssd1306_present_busy(ssd1306_t* s);
+
+// Called (from the DMA IRQ when async) after each present has been handed
+// to the bus
+void ssd1306_set_present_callback(ssd1306_t* s, void (*cb)(void* user), void* user);
+
+// Called from ssd1306_show / ssd1306_present_async, before anything of the
+// new frame is sent: marks frame boundaries for profiling
+void ssd1306_set_frame_hook(ssd1306_t* s, void (*hook)(void* user), void* user);
+
+// Mark a region as changed after writing s->buf directly
+void ssd1306_mark_dirty(ssd1306_t* s, int x, int y, int w, int h);
+
+// Force the next show to resend the whole framebuffer
+void ssd1306_invalidate(ssd1306_t* s);
+
 // Draw a single pixel
 void ssd1306_pixel(ssd1306_t* s, int x, int y, bool colour);
 
 // Fill a rectangle
 void ssd1306_rect(ssd1306_t* s, int x, int y, int w, int h, bool colour);
 
+// Horizontal / vertical line
+void ssd1306_hline(ssd1306_t* s, int x, int y, int w, bool colour);
+void ssd1306_vline(ssd1306_t* s, int x, int y, int h, bool colour);
+
+// Flip every pixel in a rectangle
+void ssd1306_invert_rect(ssd1306_t* s, int x, int y, int w, int h);
+
 // Draw a character (5x7 font)
 void ssd1306_char(ssd1306_t* s, int x, int y, char c, bool colour);
 
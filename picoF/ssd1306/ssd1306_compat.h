@@ -1,5 +1,6 @@
 #pragma once
 #include "ssd1306.h"
+#include "gfx.h"
 
 // You must have a global or file‑scope ssd1306_t instance named `disp`
 // that is already initialized before calling these.
@@ -8,4 +9,4 @@
 #define ssd1306_draw_string(x, y, str, c, bg) ssd1306_string(&disp, x, y, str, c)
 #define ssd1306_draw_pixel(x, y, c)        ssd1306_pixel(&disp, x, y, c)
 #define ssd1306_clear()                    ssd1306_clear(&disp)
-#define ssd1306_show()                     ssd1306_show(&disp)
+#define ssd1306_show()                     gfx_show() // Presents disp, timed by perf
@@ -0,0 +1,182 @@
+#include "ssd1306_transport.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include <string.h>
+
+// Control byte + one full frame of data
+static uint8_t tx_buf[1 + SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+
+// Transport behind the ssd1306_init(i2c, addr) entry point
+static ssd1306_i2c_t default_i2c;
+
+// Transports with async enabled, indexed by DMA channel
+static ssd1306_i2c_t* async_owner[NUM_DMA_CHANNELS];
+
+// Block until the bus is free for a blocking write
+static void i2c_wait(ssd1306_transport_t* base) {
+    ssd1306_i2c_t* t = (ssd1306_i2c_t*)base;
+    if (!base->async) return;
+    while (t->queued) tight_loop_contents();
+
+    // DMA is done once the FIFO holds the last byte; wait for the STOP too
+    i2c_hw_t* hw = i2c_get_hw(t->i2c);
+    while (!(hw->status & I2C_IC_STATUS_TFE_BITS)) tight_loop_contents();
+    while (hw->status & I2C_IC_STATUS_ACTIVITY_BITS) tight_loop_contents();
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;
+        base->stats.nacks++;
+    }
+}
+
+static bool i2c_busy(ssd1306_transport_t* base) {
+    return base->async && ((ssd1306_i2c_t*)base)->queued;
+}
+
+static void i2c_send(ssd1306_i2c_t* t, uint8_t control, const uint8_t* bytes, size_t n) {
+    i2c_wait(&t->base);
+    tx_buf[0] = control;
+    memcpy(&tx_buf[1], bytes, n);
+
+    ssd1306_bus_stats_t* st = &t->base.stats;
+    uint32_t t0 = time_us_32();
+    int rc = i2c_write_timeout_us(t->i2c, t->address, tx_buf, n + 1, false,
+                                  (uint)((n + 2) * SSD1306_I2C_BYTE_TIMEOUT_US));
+    st->bus_us += time_us_32() - t0;
+    st->transactions++;
+    st->bytes += (uint32_t)(n + 1);
+    if (rc == PICO_ERROR_TIMEOUT) st->timeouts++;
+    else if (rc < 0) st->nacks++;
+}
+
+// Commands go behind a single control byte (Co = 0)
+static void i2c_command(ssd1306_transport_t* base, const uint8_t* cmds, size_t n) {
+    i2c_send((ssd1306_i2c_t*)base, 0x00, cmds, n);
+}
+
+static void i2c_data(ssd1306_transport_t* base, const uint8_t* data, size_t n) {
+    i2c_send((ssd1306_i2c_t*)base, 0x40, data, n);
+}
+
+// ---- Async present ----------------------------------------------------------
+// A front buffer holds the whole present as I2C data_cmd words: per window a
+// command transaction and a data transaction, each ending in a STOP. The
+// controller starts the next transaction by itself, so one DMA transfer
+// covers every window.
+
+static void start_dma(ssd1306_i2c_t* t) {
+    uint8_t slot = t->head;
+    t->dma_start_us = time_us_32();
+    dma_channel_transfer_from_buffer_now(t->dma_chan, t->front[slot], t->front_len[slot]);
+}
+
+static void __isr i2c_dma_irq(void) {
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        ssd1306_i2c_t* t = async_owner[ch];
+        if (!t || !dma_channel_get_irq0_status(ch)) continue;
+        dma_channel_acknowledge_irq0(ch);
+        t->base.stats.bus_us += time_us_32() - t->dma_start_us;
+
+        t->head = (t->head + 1) % SSD1306_ASYNC_FRONTS;
+        t->queued--;
+        if (t->queued) start_dma(t);
+        if (t->base.done) t->base.done(t->base.done_user);
+    }
+}
+
+static bool i2c_async_init(ssd1306_transport_t* base) {
+    ssd1306_i2c_t* t = (ssd1306_i2c_t*)base;
+    if (base->async) return true;
+
+    int ch = dma_claim_unused_channel(false);
+    if (ch < 0) return false;
+
+    dma_channel_config c = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(t->i2c, true));
+    dma_channel_configure(ch, &c, &i2c_get_hw(t->i2c)->data_cmd, NULL, 0, false);
+
+    t->dma_chan = (uint8_t)ch;
+    t->head = 0;
+    t->queued = 0;
+    async_owner[ch] = t;
+
+    static bool irq_installed = false;
+    if (!irq_installed) {
+        irq_add_shared_handler(DMA_IRQ_0, i2c_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        irq_installed = true;
+    }
+    dma_channel_set_irq0_enabled(ch, true);
+    base->async = true;
+    return true;
+}
+
+static uint16_t* encode_window(uint16_t* w, const ssd1306_window_t* win, const uint8_t* buf, uint8_t width) {
+    *w++ = 0x00;
+    *w++ = 0x21; *w++ = win->x0; *w++ = win->x1;
+    *w++ = 0x22; *w++ = win->p0; *w++ = win->p1 | I2C_IC_DATA_CMD_STOP_BITS;
+
+    *w++ = 0x40;
+    for (int page = win->p0; page <= win->p1; page++) {
+        const uint8_t* row = &buf[width * page];
+        for (int x = win->x0; x <= win->x1; x++) *w++ = row[x];
+    }
+    w[-1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return w;
+}
+
+static void i2c_queue(ssd1306_transport_t* base, const ssd1306_window_t* win, int count,
+                      const uint8_t* buf, uint8_t width) {
+    ssd1306_i2c_t* t = (ssd1306_i2c_t*)base;
+
+    // Wait for a free front buffer
+    while (t->queued == SSD1306_ASYNC_FRONTS) tight_loop_contents();
+
+    uint8_t slot = (t->head + t->queued) % SSD1306_ASYNC_FRONTS;
+    uint16_t* w = t->front[slot];
+    for (int i = 0; i < count; i++) w = encode_window(w, &win[i], buf, width);
+    t->front_len[slot] = (uint16_t)(w - t->front[slot]);
+
+    // Control bytes included, as for blocking writes
+    t->base.stats.transactions += 2 * (uint32_t)count;
+    t->base.stats.bytes += t->front_len[slot];
+
+    uint32_t irq = save_and_disable_interrupts();
+    if (t->queued++ == 0) {
+        // Bus is idle: point the controller at the panel before DMA feeds it
+        i2c_hw_t* hw = i2c_get_hw(t->i2c);
+        while (hw->status & I2C_IC_STATUS_ACTIVITY_BITS) tight_loop_contents();
+        if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+            (void)hw->clr_tx_abrt;
+            base->stats.nacks++;
+        }
+        hw->enable = 0;
+        hw->tar = t->address;
+        hw->enable = 1;
+        start_dma(t);
+    }
+    restore_interrupts(irq);
+}
+
+void ssd1306_i2c_transport(ssd1306_i2c_t* t, i2c_inst_t* i2c, uint8_t addr) {
+    // Re-initialising keeps an async setup, but not a transfer in flight
+    i2c_wait(&t->base);
+
+    t->i2c = i2c;
+    t->address = addr;
+    t->base.command = i2c_command;
+    t->base.data = i2c_data;
+    t->base.async_init = i2c_async_init;
+    t->base.queue = i2c_queue;
+    t->base.busy = i2c_busy;
+    t->base.wait = i2c_wait;
+}
+
+void ssd1306_init(ssd1306_t* s, i2c_inst_t* i2c, uint8_t addr, uint8_t w, uint8_t h) {
+    ssd1306_i2c_transport(&default_i2c, i2c, addr);
+    ssd1306_init_transport(s, &default_i2c.base, w, h);
+}
@@ -0,0 +1,33 @@
+#include "ssd1306_transport.h"
+#include <string.h>
+
+static void mem_write(ssd1306_mem_t* t, uint8_t control, const uint8_t* bytes, size_t n) {
+    static uint8_t frame[1 + SSD1306_WIDTH * SSD1306_HEIGHT / 8];
+    if (n > sizeof(frame) - 1) n = sizeof(frame) - 1;
+    frame[0] = control;
+    memcpy(&frame[1], bytes, n);
+
+    t->transactions++;
+    t->bytes += n + 1;
+    if (t->sink) t->sink(t->user, frame, n + 1);
+    if (t->log && t->log_len + n + 1 <= t->log_cap) {
+        memcpy(&t->log[t->log_len], frame, n + 1);
+        t->log_len += n + 1;
+    }
+}
+
+static void mem_command(ssd1306_transport_t* base, const uint8_t* cmds, size_t n) {
+    mem_write((ssd1306_mem_t*)base, 0x00, cmds, n);
+}
+
+static void mem_data(ssd1306_transport_t* base, const uint8_t* data, size_t n) {
+    mem_write((ssd1306_mem_t*)base, 0x40, data, n);
+}
+
+void ssd1306_mem_transport(ssd1306_mem_t* t, void (*sink)(void* user, const uint8_t* bytes, size_t n), void* user) {
+    memset(t, 0, sizeof(*t));
+    t->base.command = mem_command;
+    t->base.data = mem_data;
+    t->sink = sink;
+    t->user = user;
+}
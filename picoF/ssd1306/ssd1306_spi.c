@@ -0,0 +1,183 @@
+#include "ssd1306_transport.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+// Transports with async enabled, indexed by DMA channel
+static ssd1306_spi_t* async_owner[NUM_DMA_CHANNELS];
+
+static inline void select(ssd1306_spi_t* t, bool on) {
+    if (t->cs != SSD1306_NO_PIN) gpio_put(t->cs, !on);
+}
+
+// DMA only feeds TX; drop what the RX side collected and clear the overrun
+static void drain_rx(ssd1306_spi_t* t) {
+    while (spi_is_readable(t->spi)) (void)spi_get_hw(t->spi)->dr;
+    spi_get_hw(t->spi)->icr = SPI_SSPICR_RORIC_BITS;
+}
+
+static void spi_wait(ssd1306_transport_t* base) {
+    ssd1306_spi_t* t = (ssd1306_spi_t*)base;
+    if (!base->async) return;
+    while (t->queued) tight_loop_contents();
+    while (spi_is_busy(t->spi)) tight_loop_contents();
+    drain_rx(t);
+}
+
+static bool spi_busy(ssd1306_transport_t* base) {
+    return base->async && ((ssd1306_spi_t*)base)->queued;
+}
+
+static void spi_send(ssd1306_spi_t* t, bool data, const uint8_t* bytes, size_t n) {
+    spi_wait(&t->base);
+    gpio_put(t->dc, data);
+    select(t, true);
+    spi_write_blocking(t->spi, bytes, n);
+    select(t, false);
+}
+
+static void spi_command(ssd1306_transport_t* base, const uint8_t* cmds, size_t n) {
+    spi_send((ssd1306_spi_t*)base, false, cmds, n);
+}
+
+static void spi_data(ssd1306_transport_t* base, const uint8_t* data, size_t n) {
+    spi_send((ssd1306_spi_t*)base, true, data, n);
+}
+
+// ---- Async present ----------------------------------------------------------
+// D/C can't change mid-transfer, so a front buffer is split into command and
+// data segments. The DMA IRQ waits for the shifter to go idle, flips D/C and
+// starts the next segment.
+
+static void start_segment(ssd1306_spi_t* t) {
+    const ssd1306_spi_segment_t* sg = &t->segs[t->head][t->seg];
+    gpio_put(t->dc, sg->data);
+    dma_channel_transfer_from_buffer_now(t->dma_chan, &t->front[t->head][sg->start], sg->len);
+}
+
+static void __isr spi_dma_irq(void) {
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        ssd1306_spi_t* t = async_owner[ch];
+        if (!t || !dma_channel_get_irq0_status(ch)) continue;
+        dma_channel_acknowledge_irq0(ch);
+
+        // At most a FIFO's worth of bytes left, a few microseconds at SPI clocks
+        while (spi_is_busy(t->spi)) tight_loop_contents();
+
+        if (++t->seg < t->seg_count[t->head]) {
+            start_segment(t);
+            continue;
+        }
+
+        select(t, false);
+        t->seg = 0;
+        t->head = (t->head + 1) % SSD1306_ASYNC_FRONTS;
+        t->queued--;
+        if (t->queued) {
+            select(t, true);
+            start_segment(t);
+        }
+        if (t->base.done) t->base.done(t->base.done_user);
+    }
+}
+
+static bool spi_async_init(ssd1306_transport_t* base) {
+    ssd1306_spi_t* t = (ssd1306_spi_t*)base;
+    if (base->async) return true;
+
+    int ch = dma_claim_unused_channel(false);
+    if (ch < 0) return false;
+
+    dma_channel_config c = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, spi_get_dreq(t->spi, true));
+    dma_channel_configure(ch, &c, &spi_get_hw(t->spi)->dr, NULL, 0, false);
+
+    t->dma_chan = (uint8_t)ch;
+    t->head = 0;
+    t->queued = 0;
+    t->seg = 0;
+    async_owner[ch] = t;
+
+    static bool irq_installed = false;
+    if (!irq_installed) {
+        irq_add_shared_handler(DMA_IRQ_0, spi_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        irq_installed = true;
+    }
+    dma_channel_set_irq0_enabled(ch, true);
+    base->async = true;
+    return true;
+}
+
+static void spi_queue(ssd1306_transport_t* base, const ssd1306_window_t* win, int count,
+                      const uint8_t* buf, uint8_t width) {
+    ssd1306_spi_t* t = (ssd1306_spi_t*)base;
+
+    // Wait for a free front buffer
+    while (t->queued == SSD1306_ASYNC_FRONTS) tight_loop_contents();
+
+    uint8_t slot = (t->head + t->queued) % SSD1306_ASYNC_FRONTS;
+    uint8_t* p = t->front[slot];
+    ssd1306_spi_segment_t* sg = t->segs[slot];
+    for (int i = 0; i < count; i++) {
+        const ssd1306_window_t* w = &win[i];
+        uint8_t* start = p;
+        *p++ = 0x21; *p++ = w->x0; *p++ = w->x1;
+        *p++ = 0x22; *p++ = w->p0; *p++ = w->p1;
+        *sg++ = (ssd1306_spi_segment_t){ (uint16_t)(start - t->front[slot]), 6, false };
+
+        start = p;
+        for (int page = w->p0; page <= w->p1; page++) {
+            const uint8_t* row = &buf[width * page];
+            for (int x = w->x0; x <= w->x1; x++) *p++ = row[x];
+        }
+        *sg++ = (ssd1306_spi_segment_t){ (uint16_t)(start - t->front[slot]), (uint16_t)(p - start), true };
+    }
+    t->seg_count[slot] = (uint8_t)(sg - t->segs[slot]);
+
+    uint32_t irq = save_and_disable_interrupts();
+    if (t->queued++ == 0) {
+        drain_rx(t);
+        select(t, true);
+        start_segment(t);
+    }
+    restore_interrupts(irq);
+}
+
+static void init_pin(uint8_t pin, bool level) {
+    if (pin == SSD1306_NO_PIN) return;
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_OUT);
+    gpio_put(pin, level);
+}
+
+void ssd1306_spi_transport(ssd1306_spi_t* t, spi_inst_t* spi, uint8_t dc, uint8_t cs, uint8_t rst) {
+    spi_wait(&t->base);
+
+    t->spi = spi;
+    t->dc = dc;
+    t->cs = cs;
+    t->rst = rst;
+    t->base.command = spi_command;
+    t->base.data = spi_data;
+    t->base.async_init = spi_async_init;
+    t->base.queue = spi_queue;
+    t->base.busy = spi_busy;
+    t->base.wait = spi_wait;
+
+    init_pin(dc, false);
+    init_pin(cs, true);
+    init_pin(rst, true);
+    if (rst != SSD1306_NO_PIN) {
+        sleep_ms(1);
+        gpio_put(rst, false);
+        sleep_ms(10);
+        gpio_put(rst, true);
+        sleep_ms(10);
+    }
+}
@@ -0,0 +1,136 @@
+#ifndef _SSD1306_TRANSPORT_H
+#define _SSD1306_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306.h"
+
+// Front buffers for async present: 1 = double buffering, 2 = triple
+#ifndef SSD1306_ASYNC_FRONTS
+#define SSD1306_ASYNC_FRONTS 1
+#endif
+
+// Column window over one or more pages, as set by 0x21/0x22
+typedef struct {
+    uint8_t x0, x1;
+    uint8_t p0, p1;
+} ssd1306_window_t;
+
+// Bus traffic, kept by transports that count it (I2C). Only the side that
+// drives the bus writes these; readers take them as a snapshot.
+typedef struct {
+    uint32_t transactions;      // START .. STOP
+    uint32_t bytes;             // On the wire after the address, control bytes included
+    uint32_t bus_us;            // In the write call, or DMA start .. done
+    uint32_t nacks;             // Transactions aborted (address or data NACK)
+    uint32_t timeouts;          // Blocking writes that ran out of time
+} ssd1306_bus_stats_t;
+
+typedef struct ssd1306_transport ssd1306_transport_t;
+
+// Byte transport under the SSD1306 driver. command/data are blocking and
+// must wait for any async present still on the bus. The async hooks are
+// optional; without them every present is blocking.
+struct ssd1306_transport {
+    void (*command)(ssd1306_transport_t* t, const uint8_t* cmds, size_t n);
+    void (*data)(ssd1306_transport_t* t, const uint8_t* data, size_t n);
+
+    bool (*async_init)(ssd1306_transport_t* t);
+    // Copy the windows out of buf (width bytes per page) into a front buffer
+    // and start or queue it. Blocks only while every front buffer is queued.
+    void (*queue)(ssd1306_transport_t* t, const ssd1306_window_t* win, int count,
+                  const uint8_t* buf, uint8_t width);
+    bool (*busy)(ssd1306_transport_t* t);
+    void (*wait)(ssd1306_transport_t* t);
+    // A present with nothing to send (optional; without it done just runs)
+    void (*skip)(ssd1306_transport_t* t);
+
+    bool async;                 // Set once async_init succeeded
+    void (*done)(void* user);   // Called after each queued present went out
+    void* done_user;
+
+    ssd1306_bus_stats_t stats;
+};
+
+// ---- I2C -------------------------------------------------------------------
+#include "hardware/i2c.h"
+
+// Worst case async present: per page a 7-byte window command plus control
+// byte and a full row of data, as 16-bit I2C data_cmd words
+#define SSD1306_I2C_FRONT_WORDS ((SSD1306_HEIGHT / 8) * (SSD1306_WIDTH + 8))
+
+// Blocking writes give up after this per byte (9 bit times at 50 kHz), so a
+// stuck bus shows up as a timeout instead of a hang
+#ifndef SSD1306_I2C_BYTE_TIMEOUT_US
+#define SSD1306_I2C_BYTE_TIMEOUT_US 200
+#endif
+
+typedef struct {
+    ssd1306_transport_t base;
+    i2c_inst_t* i2c;
+    uint8_t address;
+
+    uint8_t dma_chan;
+    uint32_t dma_start_us;      // When the head front went to the bus
+    volatile uint8_t head;      // Front buffer on the bus
+    volatile uint8_t queued;    // Front buffers queued or on the bus
+    uint16_t front_len[SSD1306_ASYNC_FRONTS];
+    uint16_t front[SSD1306_ASYNC_FRONTS][SSD1306_I2C_FRONT_WORDS];
+} ssd1306_i2c_t;
+
+// The I2C block and its pins must already be set up
+void ssd1306_i2c_transport(ssd1306_i2c_t* t, i2c_inst_t* i2c, uint8_t addr);
+
+// ---- 4-wire SPI ------------------------------------------------------------
+#include "hardware/spi.h"
+
+#define SSD1306_NO_PIN 0xFF
+
+// Per page a 6-byte window command and a full row of data
+#define SSD1306_SPI_FRONT_BYTES ((SSD1306_HEIGHT / 8) * (SSD1306_WIDTH + 6))
+#define SSD1306_SPI_SEGMENTS    ((SSD1306_HEIGHT / 8) * 2)
+
+typedef struct {
+    uint16_t start;
+    uint16_t len;
+    bool data;                  // Level of D/C while this segment is sent
+} ssd1306_spi_segment_t;
+
+typedef struct {
+    ssd1306_transport_t base;
+    spi_inst_t* spi;
+    uint8_t dc, cs, rst;
+
+    uint8_t dma_chan;
+    volatile uint8_t head;
+    volatile uint8_t queued;
+    volatile uint8_t seg;       // Segment of the head front on the bus
+    uint8_t seg_count[SSD1306_ASYNC_FRONTS];
+    ssd1306_spi_segment_t segs[SSD1306_ASYNC_FRONTS][SSD1306_SPI_SEGMENTS];
+    uint8_t front[SSD1306_ASYNC_FRONTS][SSD1306_SPI_FRONT_BYTES];
+} ssd1306_spi_t;
+
+// The SPI block (mode 0) and its SCK/MOSI pins must already be set up. D/C,
+// CS and RST are driven here; pass SSD1306_NO_PIN for CS/RST if not wired.
+// Pulses RST when wired.
+void ssd1306_spi_transport(ssd1306_spi_t* t, spi_inst_t* spi, uint8_t dc, uint8_t cs, uint8_t rst);
+
+// ---- Memory ----------------------------------------------------------------
+// Records the bytes an I2C panel would receive (control byte first) instead
+// of driving hardware. Each write goes to the sink, if set, and is appended
+// to log while it has room.
+typedef struct {
+    ssd1306_transport_t base;
+    void (*sink)(void* user, const uint8_t* bytes, size_t n);
+    void* user;
+    uint8_t* log;
+    size_t log_cap;
+    size_t log_len;
+    uint32_t transactions;
+    uint32_t bytes;
+} ssd1306_mem_t;
+
+void ssd1306_mem_transport(ssd1306_mem_t* t, void (*sink)(void* user, const uint8_t* bytes, size_t n), void* user);
+
+#endif
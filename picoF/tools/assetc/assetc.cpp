@@ -0,0 +1,540 @@
+// assetc.cpp
+// Host asset compiler for picoF.
+//
+//   assetc clip --name NAME --out FILE.c [--ms N] [--timing FILE]
+//               [--threshold N] FRAME...
+//   assetc pack --out FILE.bin [--uf2 FILE.uf2 --offset N] [--ms N]
+//               [--threshold N] ASSET...
+//
+// clip reads a PBM/PGM frame sequence (P1/P4/P2/P5), converts it to the
+// SSD1306 page-major layout and writes an anim_codec.h clip as C:
+// - consecutive identical frames merge into one entry (durations add up)
+// - a frame seen earlier as a key frame reuses that key chunk
+// - identical chunks (e.g. a looped run of deltas) are stored once
+// - every entry carries its display time in ms
+//
+// PBM 1 bits light a pixel; PGM pixels light at or above the threshold
+// (default: half of maxval). The timing file holds "<frame file> <ms>"
+// lines; frames not listed get --ms (default 100). The output is only
+// rewritten when its contents change, so unchanged clips don't recompile.
+//
+// pack builds an asset pack (assets/asset_pack.h) for the flash region at
+// --offset, and with --uf2 a UF2 image that writes only that region. Each
+// ASSET is one of
+//   clip:NAME=DIR      DIR/*.pbm|*.pgm in name order, DIR/timing.txt if any
+//   bitmap:NAME=FILE   one PBM/PGM image, page-major 1bpp
+//   raw:NAME=FILE      the file's bytes
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "anim_codec.h"
+#include "asset_pack.h"
+
+namespace {
+
+struct Frame {
+    std::string path;
+    std::vector<uint8_t> pages;   // page-major, width * height / 8 bytes
+    uint32_t ms = 0;
+};
+
+std::string basename_of(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// ---- Netpbm reader ----------------------------------------------------------
+class Pnm {
+public:
+    explicit Pnm(const std::string& path) : path_(path) {
+        std::ifstream f(path, std::ios::binary);
+        if (!f) fail("cannot open");
+        buf_.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+
+    // Returns lit/unlit pixels, row-major
+    std::vector<bool> read(int& w, int& h, int threshold) {
+        if (buf_.size() < 2 || buf_[0] != 'P') fail("not a PBM/PGM file");
+        char kind = buf_[1];
+        pos_ = 2;
+        w = number();
+        h = number();
+        int maxval = (kind == '2' || kind == '5') ? number() : 1;
+        if (w <= 0 || h <= 0 || maxval <= 0 || maxval > 65535) fail("bad header");
+        if (threshold < 0) threshold = (maxval + 1) / 2;
+
+        std::vector<bool> px((size_t)w * h);
+        switch (kind) {
+        case '1':
+            for (auto&& p : px) p = bit();
+            break;
+        case '4': {
+            pos_++;   // single whitespace after the header
+            size_t stride = ((size_t)w + 7) / 8;
+            need(stride * h);
+            for (int y = 0; y < h; y++)
+                for (int x = 0; x < w; x++)
+                    px[(size_t)y * w + x] = (uint8_t)buf_[pos_ + y * stride + x / 8] & (0x80 >> (x & 7));
+            break;
+        }
+        case '2':
+            for (auto&& p : px) p = number() >= threshold;
+            break;
+        case '5': {
+            pos_++;
+            size_t bpp = maxval > 255 ? 2 : 1;
+            need(px.size() * bpp);
+            for (size_t i = 0; i < px.size(); i++) {
+                const uint8_t* s = (const uint8_t*)&buf_[pos_ + i * bpp];
+                int v = bpp == 2 ? (s[0] << 8 | s[1]) : s[0];
+                px[i] = v >= threshold;
+            }
+            break;
+        }
+        default:
+            fail("unsupported format (want P1, P2, P4 or P5)");
+        }
+        return px;
+    }
+
+private:
+    [[noreturn]] void fail(const char* why) const {
+        throw std::runtime_error(path_ + ": " + why);
+    }
+
+    void need(size_t n) const {
+        if (pos_ + n > buf_.size()) fail("truncated pixel data");
+    }
+
+    void skip_space() {
+        while (pos_ < buf_.size()) {
+            char c = buf_[pos_];
+            if (c == '#') {
+                while (pos_ < buf_.size() && buf_[pos_] != '\n') pos_++;
+            } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+                pos_++;
+            } else {
+                break;
+            }
+        }
+    }
+
+    int number() {
+        skip_space();
+        if (pos_ >= buf_.size() || buf_[pos_] < '0' || buf_[pos_] > '9') fail("expected a number");
+        int v = 0;
+        while (pos_ < buf_.size() && buf_[pos_] >= '0' && buf_[pos_] <= '9') v = v * 10 + (buf_[pos_++] - '0');
+        return v;
+    }
+
+    bool bit() {
+        skip_space();
+        if (pos_ >= buf_.size() || (buf_[pos_] != '0' && buf_[pos_] != '1')) fail("expected 0 or 1");
+        return buf_[pos_++] == '1';
+    }
+
+    std::string path_;
+    std::string buf_;
+    size_t pos_ = 0;
+};
+
+std::vector<uint8_t> to_pages(const std::vector<bool>& px, int w, int h) {
+    std::vector<uint8_t> pages((size_t)w * (h / 8));
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            if (px[(size_t)y * w + x]) pages[(size_t)(y >> 3) * w + x] |= 1u << (y & 7);
+    return pages;
+}
+
+// ---- Clip compiler ----------------------------------------------------------
+struct ClipOptions {
+    std::string name, out, timing;
+    uint32_t ms = 100;
+    int threshold = -1;
+    std::vector<std::string> frames;
+};
+
+std::map<std::string, uint32_t> read_timing(const std::string& path) {
+    std::map<std::string, uint32_t> t;
+    if (path.empty()) return t;
+    std::ifstream f(path);
+    if (!f) throw std::runtime_error(path + ": cannot open");
+    std::string line;
+    while (std::getline(f, line)) {
+        std::istringstream ss(line.substr(0, line.find('#')));
+        std::string file;
+        uint32_t ms;
+        if (ss >> file >> ms) t[basename_of(file)] = ms;
+    }
+    return t;
+}
+
+bool write_if_changed(const std::string& path, const std::string& text) {
+    std::ifstream in(path, std::ios::binary);
+    if (in) {
+        std::string old((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (old == text) return false;
+    }
+    std::ofstream out(path, std::ios::binary);
+    if (!out) throw std::runtime_error(path + ": cannot write");
+    out << text;
+    return true;
+}
+
+// A compiled clip: the anim_stream_t tables and data
+struct Clip {
+    int w = 0, h = 0;
+    size_t fb = 0;
+    std::vector<Frame> frames;          // Entries after merging
+    std::vector<uint8_t> data;
+    std::vector<uint32_t> offsets;
+    size_t merged = 0, shared = 0, keys = 0;
+
+    uint16_t duration(size_t i) const { return (uint16_t)(frames[i].ms > 0xFFFF ? 0xFFFF : frames[i].ms); }
+};
+
+Clip encode_clip(const ClipOptions& o) {
+    auto timing = read_timing(o.timing);
+    int w = 0, h = 0;
+
+    // Load, merging consecutive duplicates
+    Clip clip;
+    auto& frames = clip.frames;
+    size_t& merged = clip.merged;
+    for (const auto& path : o.frames) {
+        int fw, fh;
+        auto px = Pnm(path).read(fw, fh, o.threshold);
+        if (frames.empty() && w == 0) {
+            w = fw;
+            h = fh;
+            if (h % 8 || (size_t)w * h / 8 > 0xFFFF) throw std::runtime_error(path + ": height must be a multiple of 8 and the frame at most 64 KB");
+        } else if (fw != w || fh != h) {
+            throw std::runtime_error(path + ": frame size differs from the first frame");
+        }
+
+        auto it = timing.find(basename_of(path));
+        uint32_t ms = it != timing.end() ? it->second : o.ms;
+        auto pages = to_pages(px, w, h);
+        if (!frames.empty() && frames.back().pages == pages) {
+            frames.back().ms += ms;
+            merged++;
+            continue;
+        }
+        frames.push_back({path, std::move(pages), ms});
+    }
+    if (frames.size() > 0xFFFF) throw std::runtime_error("clip: too many frames");
+
+    // Encode, sharing key frames and identical chunks
+    const size_t fb = frames[0].pages.size();
+    auto& data = clip.data;
+    auto& offsets = clip.offsets;
+    std::map<std::vector<uint8_t>, uint32_t> key_of_frame, chunk_at;
+    std::vector<uint8_t> chunk(anim_encode_bound(fb));
+    size_t& keys = clip.keys;
+    size_t& shared = clip.shared;
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        const auto& cur = frames[i].pages;
+        auto key = key_of_frame.find(cur);
+        if (key != key_of_frame.end()) {
+            offsets.push_back(key->second);
+            shared++;
+            continue;
+        }
+
+        size_t n = anim_encode_frame(i ? frames[i - 1].pages.data() : nullptr, cur.data(), fb, chunk.data());
+        std::vector<uint8_t> bytes(chunk.begin(), chunk.begin() + n);
+        auto same = chunk_at.find(bytes);
+        uint32_t at;
+        if (same != chunk_at.end()) {
+            at = same->second;
+            shared++;
+        } else {
+            at = (uint32_t)data.size();
+            data.insert(data.end(), bytes.begin(), bytes.end());
+            chunk_at.emplace(bytes, at);
+        }
+        if (bytes[0] == ANIM_KEY) {
+            key_of_frame.emplace(cur, at);
+            keys++;
+        }
+        offsets.push_back(at);
+    }
+    offsets.push_back((uint32_t)data.size());
+
+    // Round-trip check
+    anim_stream_t a = {(uint16_t)w, (uint16_t)h, (uint16_t)frames.size(), (uint16_t)fb,
+                       offsets.data(), nullptr, data.data()};
+    std::vector<uint8_t> out(fb);
+    for (size_t i = 0; i < frames.size(); i++) {
+        anim_decode_frame(&a, (uint16_t)i, out.data());
+        if (out != frames[i].pages) throw std::runtime_error(frames[i].path + ": does not round-trip");
+    }
+
+    clip.w = w;
+    clip.h = h;
+    clip.fb = fb;
+    return clip;
+}
+
+void print_clip_stats(const std::string& name, size_t inputs, const Clip& clip, size_t packed, bool changed) {
+    size_t raw = inputs * clip.fb;
+    printf("assetc: %s: %zu frames -> %zu entries (%zu merged, %zu shared, %zu key), "
+           "%zu -> %zu bytes (%.2fx)%s\n",
+           name.c_str(), inputs, clip.frames.size(), clip.merged, clip.shared, clip.keys,
+           raw, packed, (double)raw / packed, changed ? "" : ", unchanged");
+}
+
+int compile_clip(const ClipOptions& o) {
+    if (o.name.empty() || o.out.empty() || o.frames.empty())
+        throw std::runtime_error("clip: --name, --out and at least one frame are required");
+
+    Clip clip = encode_clip(o);
+    const auto& frames = clip.frames;
+    const auto& data = clip.data;
+    const auto& offsets = clip.offsets;
+
+    // Emit
+    std::ostringstream c;
+    char tmp[32];
+    c << "// Generated by assetc from " << o.frames.size() << " frames - do not edit\n\n";
+    c << "#include \"anim_codec.h\"\n\n";
+    c << "static const uint8_t " << o.name << "_data[" << data.size() << "] = {";
+    for (size_t i = 0; i < data.size(); i++) {
+        snprintf(tmp, sizeof tmp, "%s0x%02X,", i % 16 ? " " : "\n    ", data[i]);
+        c << tmp;
+    }
+    c << "\n};\n\nstatic const uint32_t " << o.name << "_offsets[" << offsets.size() << "] = {";
+    for (size_t i = 0; i < offsets.size(); i++) c << (i % 10 ? " " : "\n    ") << offsets[i] << ',';
+    c << "\n};\n\nstatic const uint16_t " << o.name << "_durations[" << frames.size() << "] = {";
+    for (size_t i = 0; i < frames.size(); i++)
+        c << (i % 10 ? " " : "\n    ") << clip.duration(i) << ',';
+    c << "\n};\n\nconst anim_stream_t " << o.name << "_anim = {\n"
+      << "    .width = " << clip.w << ", .height = " << clip.h << ",\n"
+      << "    .frame_count = " << frames.size() << ", .frame_bytes = " << clip.fb << ",\n"
+      << "    .offsets = " << o.name << "_offsets,\n"
+      << "    .durations = " << o.name << "_durations,\n"
+      << "    .data = " << o.name << "_data,\n};\n";
+
+    bool changed = write_if_changed(o.out, c.str());
+    print_clip_stats(o.name, o.frames.size(), clip,
+                     data.size() + offsets.size() * 4 + frames.size() * 2, changed);
+    return 0;
+}
+
+// ---- Asset pack -------------------------------------------------------------
+struct PackOptions {
+    std::string out, uf2;
+    uint32_t offset = 0;
+    uint32_t ms = 100;
+    int threshold = -1;
+    std::vector<std::string> assets;
+};
+
+struct PackEntry {
+    std::string name;
+    uint8_t type, compression;
+    std::vector<uint8_t> body;
+};
+
+template <typename T>
+void append(std::vector<uint8_t>& v, const T& x) {
+    const uint8_t* p = (const uint8_t*)&x;
+    v.insert(v.end(), p, p + sizeof x);
+}
+
+std::vector<uint8_t> read_file(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) throw std::runtime_error(path + ": cannot open");
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+PackEntry pack_clip(const std::string& name, const std::string& dir, const PackOptions& po) {
+    namespace fs = std::filesystem;
+    ClipOptions o;
+    o.name = name;
+    o.ms = po.ms;
+    o.threshold = po.threshold;
+    for (const auto& f : fs::directory_iterator(dir)) {
+        auto ext = f.path().extension();
+        if (ext == ".pbm" || ext == ".pgm") o.frames.push_back(f.path().string());
+    }
+    std::sort(o.frames.begin(), o.frames.end());
+    if (o.frames.empty()) throw std::runtime_error(dir + ": no .pbm/.pgm frames");
+    if (fs::exists(fs::path(dir) / "timing.txt")) o.timing = (fs::path(dir) / "timing.txt").string();
+
+    Clip clip = encode_clip(o);
+    PackEntry e{name, ASSET_CLIP, ASSET_ANIM_RLE, {}};
+    append(e.body, asset_clip_header_t{(uint16_t)clip.w, (uint16_t)clip.h,
+                                       (uint16_t)clip.frames.size(), (uint16_t)clip.fb});
+    for (uint32_t off : clip.offsets) append(e.body, off);
+    for (size_t i = 0; i < clip.frames.size(); i++) append(e.body, clip.duration(i));
+    e.body.insert(e.body.end(), clip.data.begin(), clip.data.end());
+    print_clip_stats(name, o.frames.size(), clip, e.body.size(), true);
+    return e;
+}
+
+PackEntry pack_bitmap(const std::string& name, const std::string& path, const PackOptions& po) {
+    int w, h;
+    auto px = Pnm(path).read(w, h, po.threshold);
+    if (h % 8 || w > 0xFFFF || h > 0xFFFF) throw std::runtime_error(path + ": height must be a multiple of 8");
+    PackEntry e{name, ASSET_BITMAP, ASSET_STORED, {}};
+    append(e.body, asset_bitmap_header_t{(uint16_t)w, (uint16_t)h});
+    auto pages = to_pages(px, w, h);
+    e.body.insert(e.body.end(), pages.begin(), pages.end());
+    return e;
+}
+
+uint32_t crc32(const uint8_t* p, size_t n) {
+    uint32_t crc = 0xFFFFFFFFu;
+    while (n--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// UF2 blocks of 256 payload bytes for the RP2040 boot ROM, which erases
+// and programs only the sectors they cover
+std::string to_uf2(const std::vector<uint8_t>& bin, uint32_t addr) {
+    const uint32_t family_rp2040 = 0xE48BFF56u;
+    uint32_t blocks = (uint32_t)((bin.size() + 255) / 256);
+    std::string out;
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint32_t head[8] = {0x0A324655u, 0x9E5D5157u, 0x00002000u, addr + b * 256, 256, b, blocks, family_rp2040};
+        uint8_t payload[476] = {};
+        size_t n = std::min<size_t>(256, bin.size() - (size_t)b * 256);
+        memcpy(payload, &bin[(size_t)b * 256], n);
+        uint32_t tail = 0x0AB16F30u;
+        out.append((const char*)head, sizeof head);
+        out.append((const char*)payload, sizeof payload);
+        out.append((const char*)&tail, sizeof tail);
+    }
+    return out;
+}
+
+int compile_pack(const PackOptions& o) {
+    if (o.out.empty() || o.assets.empty()) throw std::runtime_error("pack: --out and at least one asset are required");
+
+    std::vector<PackEntry> entries;
+    for (const auto& spec : o.assets) {
+        size_t colon = spec.find(':'), eq = spec.find('=');
+        if (colon == std::string::npos || eq == std::string::npos || eq < colon)
+            throw std::runtime_error(spec + ": want TYPE:NAME=PATH");
+        std::string type = spec.substr(0, colon), name = spec.substr(colon + 1, eq - colon - 1);
+        std::string path = spec.substr(eq + 1);
+        if (name.empty() || name.size() >= ASSET_NAME_MAX)
+            throw std::runtime_error(spec + ": name must be 1-" + std::to_string(ASSET_NAME_MAX - 1) + " characters");
+
+        if (type == "clip") entries.push_back(pack_clip(name, path, o));
+        else if (type == "bitmap") entries.push_back(pack_bitmap(name, path, o));
+        else if (type == "raw") entries.push_back({name, ASSET_RAW, ASSET_STORED, read_file(path)});
+        else throw std::runtime_error(spec + ": unknown asset type " + type);
+    }
+
+    // Index sorted for the firmware's binary search
+    std::sort(entries.begin(), entries.end(), [](const PackEntry& a, const PackEntry& b) { return a.name < b.name; });
+    for (size_t i = 1; i < entries.size(); i++)
+        if (entries[i].name == entries[i - 1].name) throw std::runtime_error("pack: duplicate asset " + entries[i].name);
+    if (entries.size() > ASSET_MAX_COUNT) throw std::runtime_error("pack: too many assets");
+
+    std::vector<uint8_t> index, body;
+    uint32_t at = (uint32_t)(sizeof(asset_pack_header_t) + entries.size() * sizeof(asset_entry_t));
+    for (const auto& e : entries) {
+        asset_entry_t ent = {};
+        memcpy(ent.name, e.name.data(), e.name.size());
+        ent.type = e.type;
+        ent.compression = e.compression;
+        ent.offset = at + (uint32_t)body.size();
+        ent.size = (uint32_t)e.body.size();
+        ent.crc32 = crc32(e.body.data(), e.body.size());
+        append(index, ent);
+        body.insert(body.end(), e.body.begin(), e.body.end());
+        body.resize((body.size() + 3) & ~(size_t)3);
+    }
+
+    std::vector<uint8_t> pack;
+    asset_pack_header_t h = {ASSET_PACK_MAGIC, ASSET_PACK_VERSION, (uint16_t)entries.size(),
+                             (uint32_t)(sizeof h + index.size() + body.size()),
+                             crc32(index.data(), index.size())};
+    append(pack, h);
+    pack.insert(pack.end(), index.begin(), index.end());
+    pack.insert(pack.end(), body.begin(), body.end());
+
+    bool changed = write_if_changed(o.out, std::string(pack.begin(), pack.end()));
+    if (!o.uf2.empty()) write_if_changed(o.uf2, to_uf2(pack, 0x10000000u + o.offset));
+    printf("assetc: pack: %zu assets, %zu bytes%s\n", entries.size(), pack.size(), changed ? "" : ", unchanged");
+    return 0;
+}
+
+void usage() {
+    fprintf(stderr,
+            "usage: assetc clip --name NAME --out FILE.c [--ms N] [--timing FILE]\n"
+            "                   [--threshold N] FRAME...\n"
+            "       assetc pack --out FILE.bin [--uf2 FILE.uf2 --offset N] [--ms N]\n"
+            "                   [--threshold N] clip:NAME=DIR|bitmap:NAME=FILE|raw:NAME=FILE...\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+    try {
+        std::string cmd = argv[1];
+        if (cmd == "pack") {
+            PackOptions o;
+            for (int i = 2; i < argc; i++) {
+                std::string arg = argv[i];
+                auto value = [&]() -> std::string {
+                    if (i + 1 >= argc) throw std::runtime_error(arg + " needs a value");
+                    return argv[++i];
+                };
+                if (arg == "--out") o.out = value();
+                else if (arg == "--uf2") o.uf2 = value();
+                else if (arg == "--offset") o.offset = (uint32_t)std::stoul(value(), nullptr, 0);
+                else if (arg == "--ms") o.ms = (uint32_t)std::stoul(value());
+                else if (arg == "--threshold") o.threshold = std::stoi(value());
+                else if (arg.rfind("--", 0) == 0) throw std::runtime_error("unknown option " + arg);
+                else o.assets.push_back(arg);
+            }
+            return compile_pack(o);
+        }
+        if (cmd != "clip") {
+            usage();
+            return 2;
+        }
+
+        ClipOptions o;
+        for (int i = 2; i < argc; i++) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error(arg + " needs a value");
+                return argv[++i];
+            };
+            if (arg == "--name") o.name = value();
+            else if (arg == "--out") o.out = value();
+            else if (arg == "--ms") o.ms = (uint32_t)std::stoul(value());
+            else if (arg == "--timing") o.timing = value();
+            else if (arg == "--threshold") o.threshold = std::stoi(value());
+            else if (arg.rfind("--", 0) == 0) throw std::runtime_error("unknown option " + arg);
+            else o.frames.push_back(arg);
+        }
+        return compile_clip(o);
+    } catch (const std::exception& e) {
+        fprintf(stderr, "assetc: %s\n", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Decode the bus profiler's stdio lines (see busprof/busprof.h).
+
+Usage: busprof.py [SOURCE] [--live] [--csv OUT]
+
+SOURCE is a log file or the board's USB CDC device (e.g. /dev/ttyACM0,
+read until Ctrl-C); stdin if omitted. Other output on the same stream is
+skipped. Prints a per-program table at the end; --live also prints each
+period as it arrives, --csv writes every decoded record with a header.
+"""
+import argparse
+import csv
+import sys
+
+COUNTERS = ["frames", "transactions", "bytes", "bus_us",
+            "frame_us_max", "frame_bytes_max", "nacks", "timeouts"]
+FIELDS = {
+    "bus": ["t_ms", "program"] + COUNTERS,
+    "bus_program": ["t_ms", "program", "elapsed_ms"] + COUNTERS,
+}
+
+
+def parse(line):
+    parts = line.strip().split(",")
+    fields = FIELDS.get(parts[0])
+    if not fields or len(parts) != len(fields) + 1:
+        return None
+    rec = {"kind": parts[0]}
+    try:
+        for name, value in zip(fields, parts[1:]):
+            rec[name] = value if name == "program" else int(value)
+    except ValueError:
+        return None
+    return rec
+
+
+def per_frame(total, frames):
+    return total / frames if frames else 0.0
+
+
+def describe(rec):
+    f = rec["frames"]
+    return ("%8d ms  %-12s %4d frames  %6.0f us/frame (max %d)  %6.0f B/frame (max %d)  "
+            "%4.1f txn/frame  nack %d  timeout %d" % (
+                rec["t_ms"], rec["program"], f,
+                per_frame(rec["bus_us"], f), rec["frame_us_max"],
+                per_frame(rec["bytes"], f), rec["frame_bytes_max"],
+                per_frame(rec["transactions"], f), rec["nacks"], rec["timeouts"]))
+
+
+def summarize(totals, out):
+    if not totals:
+        out.write("no bus_program records\n")
+        return
+    out.write("%-12s %7s %7s %6s %9s %9s %8s %6s %8s %8s %5s %7s\n" % (
+        "program", "runs", "frames", "fps", "us/frame", "max us", "B/frame",
+        "txn/f", "max B", "bus %", "nack", "timeout"))
+    for name, t in totals.items():
+        f = t["frames"]
+        secs = t["elapsed_ms"] / 1000.0
+        out.write("%-12s %7d %7d %6.1f %9.0f %9d %8.0f %6.1f %8d %8.1f %5d %7d\n" % (
+            name, t["runs"], f, f / secs if secs else 0.0,
+            per_frame(t["bus_us"], f), t["frame_us_max"],
+            per_frame(t["bytes"], f), per_frame(t["transactions"], f),
+            t["frame_bytes_max"],
+            100.0 * t["bus_us"] / (t["elapsed_ms"] * 1000) if t["elapsed_ms"] else 0.0,
+            t["nacks"], t["timeouts"]))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("source", nargs="?", help="log file or serial device (default stdin)")
+    ap.add_argument("--live", action="store_true", help="print each period as it arrives")
+    ap.add_argument("--csv", metavar="OUT", help="write the decoded records as CSV")
+    args = ap.parse_args()
+
+    src = open(args.source, "r", errors="replace") if args.source else sys.stdin
+    writer = None
+    if args.csv:
+        csv_out = open(args.csv, "w", newline="")
+        writer = csv.DictWriter(csv_out, ["kind"] + FIELDS["bus_program"], restval="")
+        writer.writeheader()
+
+    totals = {}
+    try:
+        for line in src:
+            rec = parse(line)
+            if not rec:
+                continue
+            if writer:
+                writer.writerow(rec)
+            if rec["kind"] == "bus":
+                if args.live:
+                    print(describe(rec), flush=True)
+                continue
+            t = totals.setdefault(rec["program"], dict.fromkeys(COUNTERS + ["elapsed_ms", "runs"], 0))
+            t["runs"] += 1
+            t["elapsed_ms"] += rec["elapsed_ms"]
+            for k in COUNTERS:
+                if k.endswith("_max"):
+                    t[k] = max(t[k], rec[k])
+                else:
+                    t[k] += rec[k]
+    except KeyboardInterrupt:
+        pass
+
+    summarize(totals, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
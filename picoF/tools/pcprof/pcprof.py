@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Flat profile from the PC sampling profiler's stdio output (see prof/prof.h).
+
+Usage: pcprof.py ELF [SOURCE] [--program NAME] [--top N] [--lines N]
+                 [--nm arm-none-eabi-nm] [--addr2line arm-none-eabi-addr2line]
+
+SOURCE is a log file or the board's USB CDC device (e.g. /dev/ttyACM0,
+read until Ctrl-C); stdin if omitted. Other output on the same stream is
+skipped. Runs of the same program are added up. PCs are symbolized with
+nm against ELF (build/picoF.elf); --lines also resolves the hottest PCs to
+source lines with addr2line.
+"""
+import argparse
+import bisect
+import subprocess
+import sys
+
+
+def load_symbols(nm, elf):
+    out = subprocess.run([nm, "-S", "-n", "-C", "--defined-only", elf],
+                         check=True, capture_output=True, text=True).stdout
+    syms = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4:
+            addr, size, kind, name = parts
+        elif len(parts) == 3:
+            addr, kind, name = parts
+            size = None
+        else:
+            continue
+        if kind not in "tTwW":
+            continue
+        start = int(addr, 16) & ~1      # Thumb bit
+        syms.append((start, int(size, 16) if size else None, name))
+    syms.sort()
+    return syms
+
+
+def symbolize(syms, starts, pc):
+    i = bisect.bisect_right(starts, pc) - 1
+    if i < 0:
+        return "?"
+    start, size, name = syms[i]
+    if size is not None and pc >= start + size:
+        return "?"
+    return name
+
+
+def read_profiles(src):
+    """{program: {"hz", "samples", "dropped", "runs", "pcs": {pc: count}}}"""
+    profiles = {}
+    current = None
+    try:
+        for line in src:
+            parts = line.strip().split(",")
+            if parts[0] == "prof_begin" and len(parts) == 5:
+                p = profiles.setdefault(parts[1], {"hz": int(parts[2]), "samples": 0,
+                                                   "dropped": 0, "runs": 0, "pcs": {}})
+                p["samples"] += int(parts[3])
+                p["dropped"] += int(parts[4])
+                p["runs"] += 1
+                current = p
+            elif parts[0] == "prof" and len(parts) == 3 and current is not None:
+                pc = int(parts[1], 16)
+                current["pcs"][pc] = current["pcs"].get(pc, 0) + int(parts[2])
+            elif parts[0] == "prof_end":
+                current = None
+    except KeyboardInterrupt:
+        pass
+    return profiles
+
+
+def report(name, p, syms, starts, args):
+    total = p["samples"] - p["dropped"]
+    print("== %s: %d runs, %d samples at %d Hz (%.1f s), %d dropped" % (
+        name, p["runs"], p["samples"], p["hz"], p["samples"] / p["hz"] if p["hz"] else 0,
+        p["dropped"]))
+    if not total:
+        return
+
+    funcs = {}
+    for pc, n in p["pcs"].items():
+        f = symbolize(syms, starts, pc)
+        funcs[f] = funcs.get(f, 0) + n
+
+    print("%7s %7s %8s  %s" % ("%", "cum %", "samples", "function"))
+    cum = 0
+    for f, n in sorted(funcs.items(), key=lambda kv: -kv[1])[:args.top]:
+        cum += n
+        print("%6.1f%% %6.1f%% %8d  %s" % (100.0 * n / total, 100.0 * cum / total, n, f))
+
+    if args.lines:
+        hot = sorted(p["pcs"].items(), key=lambda kv: -kv[1])[:args.lines]
+        out = subprocess.run([args.addr2line, "-f", "-C", "-e", args.elf] +
+                             ["0x%x" % pc for pc, _ in hot],
+                             check=True, capture_output=True, text=True).stdout.splitlines()
+        print("%7s %8s  %-10s  %s" % ("%", "samples", "pc", "line"))
+        for i, (pc, n) in enumerate(hot):
+            where = out[2 * i + 1] if 2 * i + 1 < len(out) else "?"
+            print("%6.1f%% %8d  0x%08x  %s" % (100.0 * n / total, n, pc, where))
+    print()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("elf", help="firmware image the samples came from (picoF.elf)")
+    ap.add_argument("source", nargs="?", help="log file or serial device (default stdin)")
+    ap.add_argument("--program", help="only this program")
+    ap.add_argument("--top", type=int, default=25, help="functions to list (default 25)")
+    ap.add_argument("--lines", type=int, default=0, metavar="N",
+                    help="also resolve the N hottest PCs to source lines")
+    ap.add_argument("--nm", default="arm-none-eabi-nm")
+    ap.add_argument("--addr2line", default="arm-none-eabi-addr2line")
+    args = ap.parse_args()
+
+    syms = load_symbols(args.nm, args.elf)
+    starts = [s[0] for s in syms]
+    src = open(args.source, "r", errors="replace") if args.source else sys.stdin
+    profiles = read_profiles(src)
+    if args.program:
+        profiles = {k: v for k, v in profiles.items() if k == args.program}
+    if not profiles:
+        sys.exit("no prof_begin records%s" % (" for " + args.program if args.program else ""))
+    for name, p in profiles.items():
+        report(name, p, syms, starts, args)
+
+
+if __name__ == "__main__":
+    main()